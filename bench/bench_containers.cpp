@@ -0,0 +1,389 @@
+// Microbenchmarks for the three containers the engine stands on:
+// FlatHashMap (order/level indexes), SlabPool (Order/Level storage) and
+// LockFreeRingBuffer (bridge rings). Key distributions mirror the LOB:
+// monotonic order ids, price ticks random-walking in a narrow band, and
+// tombstone churn from cancel-heavy flow. Each row reports ns/op plus
+// hardware cache misses per op (perf_event_open; shown as n/a where the
+// kernel denies the counter), and the final BENCH_JSON line is machine-
+// readable for release-to-release tracking, as in bench_pipeline.
+
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "LOB/FlatHashMap.h"
+#include "LOB/SlabPool.h"
+#include "LOB/Types.h"
+#include "common/market_data_packet.hpp"
+#include "memory/allocator.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+static uint64_t now_ns() {
+    return static_cast<uint64_t>(Clock::now().time_since_epoch().count());
+}
+
+template <typename T>
+static inline void do_not_optimize(const T& value) {
+    asm volatile("" : : "g"(value) : "memory");
+}
+
+namespace {
+
+/// Hardware cache-miss counter for the calling thread. Counts are best
+/// effort: in containers/VMs perf_event_open is often denied, in which
+/// case available() is false and rows print n/a.
+class CacheMissCounter {
+public:
+    CacheMissCounter() {
+#if defined(__linux__)
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd_ = static_cast<int>(
+            ::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    ~CacheMissCounter() {
+#if defined(__linux__)
+        if (fd_ >= 0) ::close(fd_);
+#endif
+    }
+
+    bool available() const { return fd_ >= 0; }
+
+    void start() {
+#if defined(__linux__)
+        if (fd_ < 0) return;
+        ::ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+        ::ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+
+    uint64_t stop() {
+#if defined(__linux__)
+        if (fd_ < 0) return 0;
+        ::ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+        uint64_t count = 0;
+        if (::read(fd_, &count, sizeof(count)) != sizeof(count)) {
+            return 0;
+        }
+        return count;
+#else
+        return 0;
+#endif
+    }
+
+private:
+    int fd_ = -1;
+};
+
+struct BenchRow {
+    std::string name;
+    uint64_t ops = 0;
+    uint64_t elapsed_ns = 0;
+    uint64_t cache_misses = 0;
+    bool misses_valid = false;
+
+    double ns_per_op() const {
+        return ops ? static_cast<double>(elapsed_ns) / static_cast<double>(ops)
+                   : 0.0;
+    }
+    double misses_per_op() const {
+        return ops ? static_cast<double>(cache_misses) /
+                         static_cast<double>(ops)
+                   : 0.0;
+    }
+};
+
+std::vector<BenchRow> g_rows;
+
+/// Time fn() over `ops` operations with the cache-miss counter running.
+template <typename Fn>
+void run_bench(const char* name, uint64_t ops, Fn&& fn) {
+    CacheMissCounter misses;
+    misses.start();
+    const uint64_t start = now_ns();
+    fn();
+    const uint64_t elapsed = now_ns() - start;
+    const uint64_t miss_count = misses.stop();
+
+    BenchRow row;
+    row.name = name;
+    row.ops = ops;
+    row.elapsed_ns = elapsed;
+    row.cache_misses = miss_count;
+    row.misses_valid = misses.available();
+    g_rows.push_back(row);
+
+    if (row.misses_valid) {
+        std::printf("  %-34s %10.1f ns/op  %8.3f miss/op  (%lu ops)\n",
+                    name, row.ns_per_op(), row.misses_per_op(), ops);
+    } else {
+        std::printf("  %-34s %10.1f ns/op  %8s miss/op  (%lu ops)\n",
+                    name, row.ns_per_op(), "n/a", ops);
+    }
+}
+
+// ─── FlatHashMap ────────────────────────────────────────────────────
+
+/// Monotonic order ids, as id_to_order sees them.
+void bench_map_sequential(uint64_t n) {
+    FlatHashMap<ID, uint64_t> map;
+    run_bench("map/insert_sequential_ids", n, [&] {
+        for (uint64_t i = 0; i < n; ++i) {
+            map[i + 1] = i;
+        }
+    });
+    uint64_t sum = 0;
+    run_bench("map/find_hit", n, [&] {
+        for (uint64_t i = 0; i < n; ++i) {
+            auto it = map.find(i + 1);
+            if (it != map.end()) sum += it->second;
+        }
+    });
+    do_not_optimize(sum);
+    run_bench("map/find_miss", n, [&] {
+        for (uint64_t i = 0; i < n; ++i) {
+            auto it = map.find(n + i + 1);
+            if (it != map.end()) sum += it->second;
+        }
+    });
+    do_not_optimize(sum);
+}
+
+/// Price keys random-walking in a narrow band, as the level maps see.
+void bench_map_price_band(uint64_t n) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> step(-20, 20);
+    std::vector<PRICE> prices;
+    prices.reserve(n);
+    PRICE mid = 4'300'000;
+    for (uint64_t i = 0; i < n; ++i) {
+        mid = static_cast<PRICE>(
+            std::max(1, static_cast<int>(mid) + step(rng)));
+        prices.push_back(mid);
+    }
+
+    FlatHashMap<PRICE, uint64_t> map;
+    run_bench("map/upsert_price_band", n, [&] {
+        for (uint64_t i = 0; i < n; ++i) {
+            map[prices[i]] = i;
+        }
+    });
+    uint64_t sum = 0;
+    run_bench("map/find_price_band", n, [&] {
+        for (uint64_t i = 0; i < n; ++i) {
+            auto it = map.find(prices[i]);
+            if (it != map.end()) sum += it->second;
+        }
+    });
+    do_not_optimize(sum);
+}
+
+/// Cancel-heavy flow: every insert is eventually erased, so probes walk
+/// tombstones. The mix is insert / find / erase interleaved 50/25/25.
+void bench_map_tombstone_churn(uint64_t n) {
+    FlatHashMap<ID, uint64_t> map;
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> op(0, 3);
+    std::vector<ID> live;
+    live.reserve(n);
+    ID next_id = 1;
+    uint64_t sum = 0;
+
+    run_bench("map/tombstone_churn_mix", n, [&] {
+        for (uint64_t i = 0; i < n; ++i) {
+            const int roll = op(rng);
+            if (roll < 2 || live.empty()) {
+                map[next_id] = i;
+                live.push_back(next_id);
+                ++next_id;
+            } else if (roll == 2) {
+                std::uniform_int_distribution<size_t> idx(0, live.size() - 1);
+                auto it = map.find(live[idx(rng)]);
+                if (it != map.end()) sum += it->second;
+            } else {
+                std::uniform_int_distribution<size_t> idx(0, live.size() - 1);
+                const size_t k = idx(rng);
+                map.erase(live[k]);
+                live[k] = live.back();
+                live.pop_back();
+            }
+        }
+    });
+    do_not_optimize(sum);
+}
+
+// ─── SlabPool ───────────────────────────────────────────────────────
+
+struct PoolNode {
+    uint64_t payload[8]; // 64 bytes, Order-sized
+    PoolNode() : payload{} {}
+};
+
+/// Alloc/free cycling across slab boundaries: fill several slabs, free a
+/// random half (populating the free list), then realloc through it.
+void bench_pool_cycling(uint64_t n) {
+    SlabPool<PoolNode, 1024> pool;
+    std::vector<PoolNode*> live;
+    live.reserve(n);
+
+    run_bench("pool/alloc_fresh_slabs", n, [&] {
+        for (uint64_t i = 0; i < n; ++i) {
+            live.push_back(pool.allocate());
+        }
+    });
+
+    std::mt19937 rng(21);
+    std::shuffle(live.begin(), live.end(), rng);
+    const uint64_t half = n / 2;
+    run_bench("pool/free_random_half", half, [&] {
+        for (uint64_t i = 0; i < half; ++i) {
+            pool.deallocate(live.back());
+            live.pop_back();
+        }
+    });
+
+    run_bench("pool/realloc_from_free_list", half, [&] {
+        for (uint64_t i = 0; i < half; ++i) {
+            live.push_back(pool.allocate());
+        }
+    });
+
+    run_bench("pool/steady_state_churn", n, [&] {
+        for (uint64_t i = 0; i < n; ++i) {
+            pool.deallocate(live.back());
+            live.back() = pool.allocate();
+            do_not_optimize(live.back());
+        }
+    });
+
+    for (PoolNode* node : live) {
+        pool.deallocate(node);
+    }
+}
+
+// ─── LockFreeRingBuffer ─────────────────────────────────────────────
+
+void pin_to_core(int core) {
+#if defined(__linux__)
+    if (core < 0) return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(static_cast<unsigned>(core), &set);
+    (void)pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)core;
+#endif
+}
+
+/// SPSC throughput at MarketDataPacket granularity. Core placement is
+/// caller-controlled (-1 = unpinned) so same-core, sibling and cross-core
+/// runs can be compared.
+void bench_ring_spsc(const char* name, uint64_t n, int producer_core,
+                     int consumer_core) {
+    using Ring =
+        engine::memory::fast::LockFreeRingBuffer<quantumflow::MarketDataPacket,
+                                                 4096>;
+    auto ring = std::make_unique<Ring>();
+    quantumflow::MarketDataPacket pkt{};
+    std::strncpy(pkt.symbol, "BTC-USDT", sizeof(pkt.symbol) - 1);
+
+    run_bench(name, n, [&] {
+        std::thread producer([&] {
+            pin_to_core(producer_core);
+            for (uint64_t i = 0; i < n; ++i) {
+                pkt.timestamp_ns = i;
+                while (!ring->tryPush(pkt)) {
+                }
+            }
+        });
+        std::thread consumer([&] {
+            pin_to_core(consumer_core);
+            quantumflow::MarketDataPacket out{};
+            uint64_t received = 0;
+            while (received < n) {
+                if (ring->tryPop(out)) {
+                    received++;
+                }
+            }
+            do_not_optimize(out);
+        });
+        producer.join();
+        consumer.join();
+    });
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    uint64_t n = 1'000'000;
+    if (argc > 1) {
+        n = std::stoull(argv[1]);
+    }
+
+    CacheMissCounter probe;
+    std::printf("Container microbenchmarks (%lu ops/row, cache misses %s)\n",
+                n, probe.available() ? "enabled" : "unavailable");
+
+    std::printf("\nFlatHashMap:\n");
+    bench_map_sequential(n);
+    bench_map_price_band(n);
+    bench_map_tombstone_churn(n);
+
+    std::printf("\nSlabPool:\n");
+    bench_pool_cycling(n);
+
+    std::printf("\nLockFreeRingBuffer (SPSC):\n");
+    const unsigned cores = std::thread::hardware_concurrency();
+    bench_ring_spsc("ring/spsc_unpinned", n, -1, -1);
+    if (cores >= 2) {
+        bench_ring_spsc("ring/spsc_cores_0_1", n, 0, 1);
+        bench_ring_spsc("ring/spsc_same_core_0", n, 0, 0);
+    }
+    if (cores >= 4) {
+        bench_ring_spsc("ring/spsc_cores_0_2", n, 0, 2);
+    }
+
+    // Machine-readable summary, one object per row.
+    std::string json = "BENCH_JSON {\"rows\":[";
+    for (size_t i = 0; i < g_rows.size(); ++i) {
+        const BenchRow& row = g_rows[i];
+        char buf[256];
+        if (row.misses_valid) {
+            std::snprintf(buf, sizeof(buf),
+                          "%s{\"name\":\"%s\",\"ops\":%lu,\"ns_per_op\":%.2f,"
+                          "\"cache_misses_per_op\":%.4f}",
+                          i ? "," : "", row.name.c_str(), row.ops,
+                          row.ns_per_op(), row.misses_per_op());
+        } else {
+            std::snprintf(buf, sizeof(buf),
+                          "%s{\"name\":\"%s\",\"ops\":%lu,\"ns_per_op\":%.2f}",
+                          i ? "," : "", row.name.c_str(), row.ops,
+                          row.ns_per_op());
+        }
+        json += buf;
+    }
+    json += "]}";
+    std::printf("\n%s\n", json.c_str());
+
+    return 0;
+}
@@ -0,0 +1,364 @@
+// End-to-end ingest-to-signal benchmark: drives the same path the headless
+// main loop runs — MarketDataBridge push, packet decode and book apply,
+// snapshot sync, strategy evaluation, JSON serialization — from either a
+// capture file (--capture) or the synthetic generator, and reports
+// per-stage throughput and latency percentiles. The final line is a single
+// JSON object (prefixed BENCH_JSON) for release-to-release tracking.
+
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "LOB/Book.h"
+#include "common/latency_histogram.hpp"
+#include "common/market_data_packet.hpp"
+#include "common/price_converter.hpp"
+#include "common/symbol_table.hpp"
+#include "bridge/packet_capture.hpp"
+#include "bridge/shared_memory.hpp"
+#include "strategies/strategy_base.hpp"
+#include "strategies/strategy_engine.hpp"
+#include "strategies/microstructure/order_book_imbalance.hpp"
+#include "strategies/microstructure/market_maker.hpp"
+#include "strategies/microstructure/vwap_executor.hpp"
+#include "strategies/microstructure/liquidity_detector.hpp"
+#include "strategies/crypto/funding_arbitrage.hpp"
+#include "strategies/crypto/momentum.hpp"
+#include "strategies/equities/pairs_trading.hpp"
+#include "ws/json_serializer.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+static uint64_t now_ns() {
+    return static_cast<uint64_t>(Clock::now().time_since_epoch().count());
+}
+
+namespace {
+
+struct BenchConfig {
+    uint64_t packets = 1'000'000;
+    std::string capture_path; // replay a capture instead of synthetic data
+};
+
+BenchConfig parse_args(int argc, char* argv[]) {
+    BenchConfig cfg;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--packets") == 0 && i + 1 < argc) {
+            cfg.packets = std::stoull(argv[++i]);
+        } else if (std::strcmp(argv[i], "--capture") == 0 && i + 1 < argc) {
+            cfg.capture_path = argv[++i];
+        }
+    }
+    return cfg;
+}
+
+/// Synthetic feed shaped like live bridge traffic. As in production, each
+/// symbol carries one feed kind: BTC-USDT is an L2 depth feed (levels set
+/// around a random-walking mid, plus trade prints) and ETH-USDT is an L3
+/// order feed (adds, cancels, the occasional aggressive cross). Prices are
+/// integer ticks, matching the wire protocol.
+std::vector<quantumflow::MarketDataPacket> generate_packets(uint64_t count,
+                                                            uint32_t seed = 42) {
+    std::vector<quantumflow::MarketDataPacket> packets;
+    packets.reserve(count);
+
+    const char* symbols[2] = {"BTC-USDT", "ETH-USDT"};
+    uint64_t mids[2] = {4'300'000, 250'000};
+
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> event_dist(0, 99);
+    std::uniform_int_distribution<int> depth_dist(1, 20);
+    std::uniform_int_distribution<uint64_t> qty_dist(1, 1000);
+    std::uniform_int_distribution<int> side_dist(0, 1);
+    std::vector<uint64_t> live_orders;
+    uint64_t next_order_id = 1;
+
+    for (uint64_t i = 0; i < count; ++i) {
+        const size_t s = i & 1;
+        quantumflow::MarketDataPacket pkt{};
+        std::strncpy(pkt.symbol, symbols[s], sizeof(pkt.symbol) - 1);
+        pkt.timestamp_ns = 1 + i;
+        pkt.side = static_cast<uint8_t>(side_dist(rng));
+        pkt.quantity = qty_dist(rng);
+
+        const int roll = event_dist(rng);
+        const int offset = depth_dist(rng);
+        if (s == 0) {
+            // L2 feed: depth updates near the mid plus trade prints.
+            if (roll < 85) {
+                pkt.event_type = quantumflow::EVENT_BOOK_LEVEL;
+                pkt.price = pkt.side == 0
+                                ? mids[s] - static_cast<uint64_t>(offset)
+                                : mids[s] + static_cast<uint64_t>(offset);
+            } else {
+                pkt.event_type = quantumflow::EVENT_TRADE;
+                pkt.price = mids[s];
+            }
+        } else if (roll < 75 || live_orders.empty()) {
+            pkt.event_type = quantumflow::EVENT_ORDER_ADD;
+            pkt.order_id = next_order_id++;
+            if (roll < 15) {
+                // Aggressive order crossing the spread: exercises matching.
+                pkt.price = pkt.side == 0
+                                ? mids[s] + static_cast<uint64_t>(offset)
+                                : mids[s] - static_cast<uint64_t>(offset);
+            } else {
+                pkt.price = pkt.side == 0
+                                ? mids[s] - static_cast<uint64_t>(offset)
+                                : mids[s] + static_cast<uint64_t>(offset);
+            }
+            live_orders.push_back(pkt.order_id);
+        } else {
+            pkt.event_type = quantumflow::EVENT_ORDER_CANCEL;
+            std::uniform_int_distribution<size_t> idx_dist(
+                0, live_orders.size() - 1);
+            const size_t idx = idx_dist(rng);
+            pkt.order_id = live_orders[idx];
+            live_orders[idx] = live_orders.back();
+            live_orders.pop_back();
+        }
+
+        // Drift the mid occasionally so levels churn like a real market.
+        if ((i & 1023) == 0) {
+            mids[s] += (side_dist(rng) == 0) ? 1 : static_cast<uint64_t>(-1);
+        }
+        packets.push_back(pkt);
+    }
+    return packets;
+}
+
+std::unique_ptr<quantumflow::StrategyEngine> make_strategy_engine() {
+    auto engine = std::make_unique<quantumflow::StrategyEngine>();
+    engine->add_strategy(std::make_unique<quantumflow::OrderBookImbalance>());
+    engine->add_strategy(std::make_unique<quantumflow::MarketMaker>());
+    engine->add_strategy(std::make_unique<quantumflow::VWAPExecutor>());
+    engine->add_strategy(std::make_unique<quantumflow::LiquidityDetector>());
+    engine->add_strategy(std::make_unique<quantumflow::FundingArbitrage>());
+    engine->add_strategy(std::make_unique<quantumflow::MomentumStrategy>());
+    engine->add_strategy(std::make_unique<quantumflow::PairsTrading>());
+    return engine;
+}
+
+void print_stage(const char* name, const quantumflow::LatencyStageStats& s) {
+    std::printf("  %-12s count=%-10lu p50=%-10.3f p99=%-10.3f p999=%-10.3f max=%.3f us\n",
+                name, s.count, s.p50_us, s.p99_us, s.p999_us, s.max_us);
+}
+
+void append_stage_json(std::string& out, const char* name,
+                       const quantumflow::LatencyStageStats& s) {
+    char buf[256];
+    std::snprintf(buf, sizeof(buf),
+                  "\"%s\":{\"count\":%lu,\"p50_us\":%.3f,\"p99_us\":%.3f,"
+                  "\"p999_us\":%.3f,\"max_us\":%.3f}",
+                  name, s.count, s.p50_us, s.p99_us, s.p999_us, s.max_us);
+    out += buf;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchConfig cfg = parse_args(argc, argv);
+
+    std::vector<quantumflow::MarketDataPacket> packets;
+    if (!cfg.capture_path.empty()) {
+        quantumflow::PacketCaptureReader reader;
+        if (!reader.open(cfg.capture_path)) {
+            return 1;
+        }
+        packets.reserve(reader.size());
+        for (uint64_t i = 0; i < reader.size(); ++i) {
+            packets.push_back(reader.at(i).packet);
+        }
+        std::printf("Loaded %zu packets from %s\n", packets.size(),
+                    cfg.capture_path.c_str());
+    } else {
+        std::printf("Generating %lu synthetic packets...\n", cfg.packets);
+        packets = generate_packets(cfg.packets);
+    }
+    if (packets.empty()) {
+        std::fprintf(stderr, "No packets to benchmark\n");
+        return 1;
+    }
+
+    // Same per-symbol state as the headless main loop.
+    quantumflow::PriceConverterRegistry price_reg(100.0);
+    quantumflow::SymbolTable symbol_table;
+
+    struct SymbolState {
+        std::unique_ptr<Book> book;
+        quantumflow::TradeRing<1024> recent_trades;
+        quantumflow::BookSnapshot snapshot;
+        bool snapshot_valid = false;
+        uint64_t trade_seq = 0;
+        uint64_t last_eval_book_version = 0;
+        uint64_t last_eval_trade_seq = 0;
+    };
+    std::vector<SymbolState> symbol_states;
+
+    auto state_for = [&](quantumflow::SymbolId id) -> SymbolState& {
+        if (id >= symbol_states.size()) {
+            symbol_states.resize(id + 1);
+        }
+        auto& st = symbol_states[id];
+        if (!st.book) {
+            st.book = std::make_unique<Book>();
+        }
+        return st;
+    };
+
+    auto sync_snapshot = [&](quantumflow::SymbolId id,
+                             SymbolState& st) -> quantumflow::BookSnapshot& {
+        if (!st.snapshot_valid) {
+            st.snapshot = quantumflow::BookSnapshot::from_book(
+                *st.book, symbol_table.name(id), price_reg.get(id));
+            st.snapshot_valid = true;
+        } else {
+            st.snapshot.update_from_book(*st.book, price_reg.get(id));
+        }
+        return st.snapshot;
+    };
+
+    auto strategy_engine = make_strategy_engine();
+
+    // Stage histograms: book_apply is timed per packet, evaluate and
+    // serialize per drain iteration, mirroring how the main loop batches.
+    quantumflow::LatencyHistogram ingest_hist;    // bridge push+pop
+    quantumflow::LatencyHistogram book_hist;      // decode + book apply
+    quantumflow::LatencyHistogram evaluate_hist;  // snapshot sync + strategies
+    quantumflow::LatencyHistogram serialize_hist; // JSON book serialization
+
+    quantumflow::MarketDataBridge bridge;
+    constexpr size_t BATCH = 256;
+    std::vector<quantumflow::MarketDataPacket> drain(BATCH);
+    std::string json_payload;
+    quantumflow::SymbolId active_id = quantumflow::INVALID_SYMBOL_ID;
+    quantumflow::SymbolId last_evaluated_id = quantumflow::INVALID_SYMBOL_ID;
+    uint64_t trades_seen = 0;
+    uint64_t serialized_bytes = 0;
+    uint64_t ws_seq = 0;
+
+    const uint64_t bench_start = now_ns();
+    size_t cursor = 0;
+    while (cursor < packets.size()) {
+        const size_t n =
+            std::min(BATCH, packets.size() - cursor);
+
+        uint64_t t0 = now_ns();
+        (void)bridge.push_batch(packets.data() + cursor, n);
+        const size_t drained = bridge.pop_batch(drain.data(), n);
+        uint64_t t1 = now_ns();
+        ingest_hist.record_ns(t1 - t0);
+        cursor += n;
+
+        for (size_t i = 0; i < drained; ++i) {
+            const quantumflow::MarketDataPacket& pkt = drain[i];
+            uint64_t pkt_start = now_ns();
+
+            quantumflow::SymbolId id = symbol_table.intern(pkt.symbol);
+            if (id == quantumflow::INVALID_SYMBOL_ID) continue;
+            active_id = id;
+            SymbolState& st = state_for(id);
+            const auto& converter = price_reg.get(id);
+
+            if (pkt.event_type == quantumflow::EVENT_BOOK_LEVEL) {
+                OrderType ot = (pkt.side == 0) ? BUY : SELL;
+                st.book->set_level(ot, static_cast<PRICE>(pkt.price),
+                                   pkt.quantity);
+            } else if (pkt.event_type == quantumflow::EVENT_TRADE) {
+                quantumflow::TradeInfo ti{
+                    converter.to_external(static_cast<PRICE>(pkt.price)),
+                    pkt.quantity, pkt.side, pkt.timestamp_ns};
+                st.recent_trades.push(ti);
+                st.trade_seq++;
+                trades_seen++;
+                strategy_engine->on_trade(ti);
+            } else if (pkt.event_type == quantumflow::EVENT_ORDER_ADD) {
+                OrderType ot = (pkt.side == 0) ? BUY : SELL;
+                st.book->place_order(
+                    pkt.order_id, 0, ot, static_cast<PRICE>(pkt.price),
+                    pkt.quantity, [&](const Trade& t) {
+                        quantumflow::TradeInfo ti{
+                            converter.to_external(t.get_trade_price()),
+                            t.get_trade_volume(), pkt.side, pkt.timestamp_ns};
+                        st.recent_trades.push(ti);
+                        st.trade_seq++;
+                        trades_seen++;
+                        strategy_engine->on_trade(ti);
+                    });
+            } else if (pkt.event_type == quantumflow::EVENT_ORDER_CANCEL) {
+                st.book->delete_order(pkt.order_id);
+            } else if (pkt.event_type == quantumflow::EVENT_ORDER_MODIFY) {
+                st.book->modify_order(pkt.order_id, pkt.quantity);
+            }
+            book_hist.record_ns(now_ns() - pkt_start);
+        }
+
+        // Evaluate + serialize once per drain, behind the same change gate
+        // as the main loop.
+        if (active_id != quantumflow::INVALID_SYMBOL_ID &&
+            active_id < symbol_states.size() && symbol_states[active_id].book) {
+            SymbolState& st = symbol_states[active_id];
+            const uint64_t book_version = st.book->version();
+            const bool unchanged = st.snapshot_valid &&
+                active_id == last_evaluated_id &&
+                book_version == st.last_eval_book_version &&
+                st.trade_seq == st.last_eval_trade_seq;
+            if (!unchanged) {
+                uint64_t eval_start = now_ns();
+                quantumflow::BookSnapshot& snapshot =
+                    sync_snapshot(active_id, st);
+                snapshot.timestamp_ns = now_ns();
+                strategy_engine->evaluate(snapshot, st.recent_trades.view());
+                last_evaluated_id = active_id;
+                st.last_eval_book_version = book_version;
+                st.last_eval_trade_seq = st.trade_seq;
+                uint64_t eval_end = now_ns();
+                evaluate_hist.record_ns(eval_end - eval_start);
+
+                quantumflow::serialize_book(snapshot, ws_seq++, json_payload);
+                serialized_bytes += json_payload.size();
+                serialize_hist.record_ns(now_ns() - eval_end);
+            }
+        }
+    }
+    const uint64_t elapsed_ns = now_ns() - bench_start;
+
+    const double elapsed_s = static_cast<double>(elapsed_ns) / 1e9;
+    const double pkt_per_s =
+        static_cast<double>(packets.size()) / (elapsed_s > 0 ? elapsed_s : 1.0);
+
+    std::printf("\nPipeline benchmark: %zu packets in %.3f s (%.0f pkt/s)\n",
+                packets.size(), elapsed_s, pkt_per_s);
+    std::printf("Trades: %lu  Serialized: %.1f MiB  Signals: %zu\n",
+                trades_seen, static_cast<double>(serialized_bytes) / (1024.0 * 1024.0),
+                strategy_engine->all_signals().size());
+    std::printf("\nPer-stage latency (one drain batch = %zu packets):\n", BATCH);
+    print_stage("ingest", ingest_hist.stats());
+    print_stage("book_apply", book_hist.stats());
+    print_stage("evaluate", evaluate_hist.stats());
+    print_stage("serialize", serialize_hist.stats());
+
+    // Machine-readable summary for regression tracking.
+    std::string json = "BENCH_JSON {";
+    char buf[160];
+    std::snprintf(buf, sizeof(buf),
+                  "\"packets\":%zu,\"elapsed_s\":%.6f,\"packets_per_sec\":%.0f,"
+                  "\"trades\":%lu,",
+                  packets.size(), elapsed_s, pkt_per_s, trades_seen);
+    json += buf;
+    append_stage_json(json, "ingest", ingest_hist.stats());
+    json += ",";
+    append_stage_json(json, "book_apply", book_hist.stats());
+    json += ",";
+    append_stage_json(json, "evaluate", evaluate_hist.stats());
+    json += ",";
+    append_stage_json(json, "serialize", serialize_hist.stats());
+    json += "}";
+    std::printf("%s\n", json.c_str());
+
+    return 0;
+}
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "common/market_data_packet.hpp"
+
+namespace quantumflow {
+
+/// Capture file layout: a fixed 4 KiB header followed by a flat array of
+/// CaptureRecord. The writer grows the file one chunk at a time and only
+/// ever maps the header plus the chunk it is filling; the reader maps the
+/// whole file read-only and indexes records directly.
+inline constexpr uint32_t QF_CAPTURE_MAGIC = 0x43504651; // "QFPC"
+inline constexpr uint32_t QF_CAPTURE_VERSION = 1;
+inline constexpr size_t QF_CAPTURE_HEADER_SIZE = 4096; // one page, mmap-aligned
+
+struct CaptureFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t record_count; // updated in place as records land
+    uint64_t first_ingest_ns;
+    uint64_t last_ingest_ns;
+};
+
+/// One captured packet plus the steady-clock timestamp at which the main
+/// loop drained it; replay pacing reproduces the inter-record gaps.
+struct CaptureRecord {
+    MarketDataPacket packet;
+    uint64_t ingest_ns;
+};
+
+static_assert(sizeof(CaptureRecord) == 64,
+              "Capture record must stay 64 bytes (one cache line) so chunk "
+              "sizes remain page-aligned");
+
+/// Appends the raw MarketDataPacket stream to a memory-mapped capture file.
+/// record() is a 64-byte store into the current mapped chunk plus a header
+/// counter bump — no syscalls on the drain path; the kernel writes pages
+/// back asynchronously. Chunks keep the mapping small on long sessions.
+class PacketCaptureWriter {
+public:
+    static constexpr size_t CHUNK_RECORDS = 65536; // 4 MiB per chunk
+
+    PacketCaptureWriter() = default;
+
+    ~PacketCaptureWriter() { close(); }
+
+    PacketCaptureWriter(const PacketCaptureWriter&) = delete;
+    PacketCaptureWriter& operator=(const PacketCaptureWriter&) = delete;
+
+    /// Create (truncate) the capture file and map the header and first
+    /// chunk. Returns false on any syscall failure; the caller runs on
+    /// without capture.
+    bool open(const std::string& path) {
+        if (header_) return true;
+
+        fd_ = ::open(path.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+        if (fd_ < 0) {
+            std::fprintf(stderr, "Failed to open capture file %s: %s\n",
+                         path.c_str(), std::strerror(errno));
+            return false;
+        }
+
+        void* base = ::mmap(nullptr, QF_CAPTURE_HEADER_SIZE,
+                            PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (::ftruncate(fd_, QF_CAPTURE_HEADER_SIZE) != 0 || base == MAP_FAILED) {
+            std::fprintf(stderr, "Failed to map capture header %s: %s\n",
+                         path.c_str(), std::strerror(errno));
+            if (base != MAP_FAILED) ::munmap(base, QF_CAPTURE_HEADER_SIZE);
+            ::close(fd_);
+            fd_ = -1;
+            return false;
+        }
+
+        header_ = static_cast<CaptureFileHeader*>(base);
+        header_->magic = QF_CAPTURE_MAGIC;
+        header_->version = QF_CAPTURE_VERSION;
+        header_->record_count = 0;
+        header_->first_ingest_ns = 0;
+        header_->last_ingest_ns = 0;
+        path_ = path;
+
+        if (!map_chunk(0)) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    bool is_open() const { return header_ != nullptr; }
+    uint64_t record_count() const { return header_ ? header_->record_count : 0; }
+
+    /// Drain-path append. Packets are never dropped: if growing the file
+    /// fails (disk full), capture stops and the engine keeps running.
+    void record(const MarketDataPacket& packet, uint64_t ingest_ns) {
+        if (!chunk_) return;
+        if (chunk_used_ == CHUNK_RECORDS) {
+            if (!map_chunk(chunk_index_ + 1)) {
+                std::fprintf(stderr,
+                             "Capture file %s stopped growing; capture disabled\n",
+                             path_.c_str());
+                return;
+            }
+        }
+        CaptureRecord& rec = chunk_[chunk_used_++];
+        rec.packet = packet;
+        rec.ingest_ns = ingest_ns;
+        if (header_->record_count == 0) {
+            header_->first_ingest_ns = ingest_ns;
+        }
+        header_->last_ingest_ns = ingest_ns;
+        header_->record_count++;
+    }
+
+    /// Trim the file to the records actually written and unmap everything.
+    void close() {
+        if (chunk_) {
+            ::munmap(chunk_, CHUNK_RECORDS * sizeof(CaptureRecord));
+            chunk_ = nullptr;
+        }
+        if (fd_ >= 0 && header_) {
+            const off_t exact = static_cast<off_t>(
+                QF_CAPTURE_HEADER_SIZE +
+                header_->record_count * sizeof(CaptureRecord));
+            (void)::ftruncate(fd_, exact);
+        }
+        if (header_) {
+            ::munmap(header_, QF_CAPTURE_HEADER_SIZE);
+            header_ = nullptr;
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+        chunk_index_ = 0;
+        chunk_used_ = 0;
+    }
+
+private:
+    bool map_chunk(size_t index) {
+        if (chunk_) {
+            ::munmap(chunk_, CHUNK_RECORDS * sizeof(CaptureRecord));
+            chunk_ = nullptr;
+        }
+        const size_t chunk_bytes = CHUNK_RECORDS * sizeof(CaptureRecord);
+        const off_t offset = static_cast<off_t>(
+            QF_CAPTURE_HEADER_SIZE + index * chunk_bytes);
+        if (::ftruncate(fd_, offset + static_cast<off_t>(chunk_bytes)) != 0) {
+            return false;
+        }
+        void* base = ::mmap(nullptr, chunk_bytes, PROT_READ | PROT_WRITE,
+                            MAP_SHARED, fd_, offset);
+        if (base == MAP_FAILED) {
+            return false;
+        }
+        chunk_ = static_cast<CaptureRecord*>(base);
+        chunk_index_ = index;
+        chunk_used_ = 0;
+        return true;
+    }
+
+    int fd_ = -1;
+    CaptureFileHeader* header_ = nullptr;
+    CaptureRecord* chunk_ = nullptr;
+    size_t chunk_index_ = 0;
+    size_t chunk_used_ = 0;
+    std::string path_;
+};
+
+/// Read-only view of a capture file: one mmap of the whole file, records
+/// indexed as a flat array. The replay loop in main.cpp walks this and
+/// pushes packets back through global_bridge().
+class PacketCaptureReader {
+public:
+    PacketCaptureReader() = default;
+
+    ~PacketCaptureReader() { close(); }
+
+    PacketCaptureReader(const PacketCaptureReader&) = delete;
+    PacketCaptureReader& operator=(const PacketCaptureReader&) = delete;
+
+    bool open(const std::string& path) {
+        if (base_) return true;
+
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            std::fprintf(stderr, "Failed to open capture file %s: %s\n",
+                         path.c_str(), std::strerror(errno));
+            return false;
+        }
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 ||
+            static_cast<size_t>(st.st_size) < QF_CAPTURE_HEADER_SIZE) {
+            std::fprintf(stderr, "Capture file %s is truncated\n", path.c_str());
+            ::close(fd);
+            return false;
+        }
+        mapped_size_ = static_cast<size_t>(st.st_size);
+
+        void* base = ::mmap(nullptr, mapped_size_, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            std::fprintf(stderr, "Failed to map capture file %s: %s\n",
+                         path.c_str(), std::strerror(errno));
+            mapped_size_ = 0;
+            return false;
+        }
+
+        const auto* header = static_cast<const CaptureFileHeader*>(base);
+        if (header->magic != QF_CAPTURE_MAGIC ||
+            header->version != QF_CAPTURE_VERSION) {
+            std::fprintf(stderr, "Capture file %s: bad magic/version\n",
+                         path.c_str());
+            ::munmap(base, mapped_size_);
+            mapped_size_ = 0;
+            return false;
+        }
+
+        // A crash mid-capture can leave record_count ahead of the data
+        // actually flushed; clamp to what the file really holds.
+        const uint64_t on_disk =
+            (mapped_size_ - QF_CAPTURE_HEADER_SIZE) / sizeof(CaptureRecord);
+        base_ = base;
+        count_ = header->record_count < on_disk ? header->record_count : on_disk;
+        return true;
+    }
+
+    bool is_open() const { return base_ != nullptr; }
+    uint64_t size() const { return count_; }
+
+    const CaptureRecord* records() const {
+        return reinterpret_cast<const CaptureRecord*>(
+            static_cast<const char*>(base_) + QF_CAPTURE_HEADER_SIZE);
+    }
+
+    const CaptureRecord& at(uint64_t i) const { return records()[i]; }
+
+    void close() {
+        if (base_) {
+            ::munmap(const_cast<void*>(base_), mapped_size_);
+            base_ = nullptr;
+        }
+        mapped_size_ = 0;
+        count_ = 0;
+    }
+
+private:
+    const void* base_ = nullptr;
+    size_t mapped_size_ = 0;
+    uint64_t count_ = 0;
+};
+
+} // namespace quantumflow
@@ -7,20 +7,40 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/socket.h>
+#include <sys/stat.h>
 #include <sys/un.h>
+#include <time.h>
 #include <unistd.h>
 
+#include "shm_ring.h"
+
 #define QF_SYMBOL_LEN 16
 #define QF_DEFAULT_SOCKET "/tmp/quantumflow_bridge.sock"
 #define QF_DEFAULT_QTY_SCALE 100000000ULL
 
+/* event_type values (mirrors EVENT_* in common/market_data_packet.hpp) */
+#define QF_EVENT_BOOK_LEVEL 0
+#define QF_EVENT_TRADE 1
+#define QF_EVENT_ORDER_ADD 2
+#define QF_EVENT_ORDER_CANCEL 3
+#define QF_EVENT_ORDER_MODIFY 4
+#define QF_EVENT_SYMBOL_CONFIG 5
+#define QF_EVENT_BOOK_CHECKSUM 6
+
+#define QF_DEFAULT_PRICE_SCALE 100ULL
+
+/* Integer wire protocol: price travels as pre-scaled ticks. The scale is
+ * announced once per symbol via QF_EVENT_SYMBOL_CONFIG (price = price
+ * scale, quantity = qty scale), so the C++ side does no floating-point
+ * work per packet. */
 typedef struct {
     char symbol[QF_SYMBOL_LEN];
     uint8_t side;
     uint8_t event_type;
     uint8_t _padding[6];
-    double price;
+    uint64_t price;
     uint64_t quantity;
     uint64_t timestamp_ns;
     uint64_t order_id;
@@ -49,6 +69,30 @@ static uint64_t to_scaled_qty(double size, uint64_t qty_scale) {
     return (uint64_t)(scaled + 0.5L);
 }
 
+static uint64_t to_scaled_price(double price, uint64_t price_scale) {
+    if (!isfinite(price) || price <= 0.0) {
+        return 0;
+    }
+    long double scaled = (long double)price * (long double)price_scale;
+    if (scaled <= 0.0L) {
+        return 0;
+    }
+    if (scaled >= (long double)UINT64_MAX) {
+        return UINT64_MAX;
+    }
+    return (uint64_t)(scaled + 0.5L);
+}
+
+/* Send-time stamp used when the caller did not timestamp the event
+ * itself. CLOCK_MONOTONIC matches the pipeline's time.monotonic_ns()
+ * stamps and the engine's steady_clock, so per-hop stage deltas stay in
+ * one clock domain. */
+static uint64_t qf_mono_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
 static void copy_symbol(char out[QF_SYMBOL_LEN], const char* symbol, Py_ssize_t len) {
     memset(out, 0, QF_SYMBOL_LEN);
     if (symbol == NULL || len <= 0) {
@@ -61,6 +105,9 @@ static void copy_symbol(char out[QF_SYMBOL_LEN], const char* symbol, Py_ssize_t
     memcpy(out, symbol, n);
 }
 
+/* Generic packet emitter so send_levels can serve both sender types. */
+typedef int (*emit_packet_fn)(void* sender, const MarketDataPacketWire* packet);
+
 static int send_packet(UdsBridgeSenderObject* self, const MarketDataPacketWire* packet) {
     if (self->fd < 0) {
         self->dropped++;
@@ -82,6 +129,10 @@ static int send_packet(UdsBridgeSenderObject* self, const MarketDataPacketWire*
     return -1;
 }
 
+static int uds_emit_packet(void* sender, const MarketDataPacketWire* packet) {
+    return send_packet((UdsBridgeSenderObject*)sender, packet);
+}
+
 static int level_from_item(PyObject* item, double* price, double* size) {
     PyObject* py_price = PyObject_GetAttrString(item, "price");
     PyObject* py_size = PyObject_GetAttrString(item, "size");
@@ -122,17 +173,22 @@ static int level_from_item(PyObject* item, double* price, double* size) {
 }
 
 static int send_levels(
-    UdsBridgeSenderObject* self,
+    void* sender,
+    emit_packet_fn emit,
     const char* symbol,
     Py_ssize_t symbol_len,
     PyObject* levels,
     uint8_t side,
     uint64_t timestamp_ns,
+    uint64_t price_scale,
     uint64_t qty_scale) {
     PyObject* it = PyObject_GetIter(levels);
     if (it == NULL) {
         return -1;
     }
+    if (timestamp_ns == 0) {
+        timestamp_ns = qf_mono_ns();
+    }
 
     PyObject* item = NULL;
     while ((item = PyIter_Next(it)) != NULL) {
@@ -148,11 +204,11 @@ static int send_levels(
         memset(&packet, 0, sizeof(packet));
         copy_symbol(packet.symbol, symbol, symbol_len);
         packet.side = side;
-        packet.event_type = 0;
-        packet.price = price;
+        packet.event_type = QF_EVENT_BOOK_LEVEL;
+        packet.price = to_scaled_price(price, price_scale);
         packet.quantity = to_scaled_qty(size, qty_scale);
         packet.timestamp_ns = timestamp_ns;
-        (void)send_packet(self, &packet);
+        (void)emit(sender, &packet);
     }
 
     Py_DECREF(it);
@@ -162,6 +218,62 @@ static int send_levels(
     return 0;
 }
 
+/* Shared argument parsing for the L3 order-event senders (add/cancel/
+ * modify). Returns 0 with *packet filled in, or -1 with a Python error
+ * set. Cancel carries no price/size; modify carries only the new size. */
+static int parse_order_event(PyObject* args, PyObject* kwargs, uint8_t event_type,
+                             MarketDataPacketWire* packet) {
+    const char* symbol = NULL;
+    Py_ssize_t symbol_len = 0;
+    int side = 0;
+    double price = 0.0;
+    double size = 0.0;
+    unsigned long long order_id = 0;
+    unsigned long long timestamp_ns = 0;
+    unsigned long long price_scale = QF_DEFAULT_PRICE_SCALE;
+    unsigned long long qty_scale = QF_DEFAULT_QTY_SCALE;
+
+    if (event_type == QF_EVENT_ORDER_ADD) {
+        static char* kwlist[] = {
+            "symbol", "side", "price", "size", "order_id", "timestamp_ns", "qty_scale",
+            "price_scale", NULL};
+        if (!PyArg_ParseTupleAndKeywords(
+                args, kwargs, "s#iddK|KKK", kwlist, &symbol, &symbol_len, &side, &price,
+                &size, &order_id, &timestamp_ns, &qty_scale, &price_scale)) {
+            return -1;
+        }
+    } else if (event_type == QF_EVENT_ORDER_MODIFY) {
+        static char* kwlist[] = {
+            "symbol", "side", "size", "order_id", "timestamp_ns", "qty_scale", NULL};
+        if (!PyArg_ParseTupleAndKeywords(
+                args, kwargs, "s#idK|KK", kwlist, &symbol, &symbol_len, &side, &size,
+                &order_id, &timestamp_ns, &qty_scale)) {
+            return -1;
+        }
+    } else {
+        static char* kwlist[] = {"symbol", "side", "order_id", "timestamp_ns", NULL};
+        if (!PyArg_ParseTupleAndKeywords(
+                args, kwargs, "s#iK|K", kwlist, &symbol, &symbol_len, &side,
+                &order_id, &timestamp_ns)) {
+            return -1;
+        }
+    }
+
+    memset(packet, 0, sizeof(*packet));
+    copy_symbol(packet->symbol, symbol, symbol_len);
+    packet->side = side == 0 ? 0 : 1;
+    packet->event_type = event_type;
+    packet->price = (event_type == QF_EVENT_ORDER_ADD)
+                        ? to_scaled_price(price, (uint64_t)price_scale)
+                        : 0;
+    packet->quantity = (event_type == QF_EVENT_ORDER_CANCEL)
+                           ? 0
+                           : to_scaled_qty(size, (uint64_t)qty_scale);
+    packet->timestamp_ns = timestamp_ns != 0 ? (uint64_t)timestamp_ns : qf_mono_ns();
+    packet->order_id = (uint64_t)order_id;
+    return 0;
+}
+
 static int UdsBridgeSender_init(UdsBridgeSenderObject* self, PyObject* args, PyObject* kwargs) {
     const char* socket_path = QF_DEFAULT_SOCKET;
     static char* kwlist[] = {"socket_path", NULL};
@@ -202,7 +314,9 @@ static void UdsBridgeSender_dealloc(UdsBridgeSenderObject* self) {
     Py_TYPE(self)->tp_free((PyObject*)self);
 }
 
-static PyObject* UdsBridgeSender_send_trade(UdsBridgeSenderObject* self, PyObject* args, PyObject* kwargs) {
+/* Shared parsing/building for the trade senders. Returns 0 with *packet
+ * filled in, or -1 with a Python error set. */
+static int parse_trade(PyObject* args, PyObject* kwargs, MarketDataPacketWire* packet) {
     const char* symbol = NULL;
     Py_ssize_t symbol_len = 0;
     int side = 0;
@@ -211,23 +325,69 @@ static PyObject* UdsBridgeSender_send_trade(UdsBridgeSenderObject* self, PyObjec
     unsigned long long timestamp_ns = 0;
     unsigned long long order_id = 0;
     unsigned long long qty_scale = QF_DEFAULT_QTY_SCALE;
+    unsigned long long price_scale = QF_DEFAULT_PRICE_SCALE;
     static char* kwlist[] = {
-        "symbol", "side", "price", "size", "timestamp_ns", "order_id", "qty_scale", NULL};
+        "symbol", "side", "price", "size", "timestamp_ns", "order_id", "qty_scale",
+        "price_scale", NULL};
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwargs, "s#iddK|KKK", kwlist, &symbol, &symbol_len, &side, &price, &size,
+            &timestamp_ns, &order_id, &qty_scale, &price_scale)) {
+        return -1;
+    }
+
+    memset(packet, 0, sizeof(*packet));
+    copy_symbol(packet->symbol, symbol, symbol_len);
+    packet->side = side == 0 ? 0 : 1;
+    packet->event_type = QF_EVENT_TRADE;
+    packet->price = to_scaled_price(price, (uint64_t)price_scale);
+    packet->quantity = to_scaled_qty(size, (uint64_t)qty_scale);
+    packet->timestamp_ns = timestamp_ns != 0 ? (uint64_t)timestamp_ns : qf_mono_ns();
+    packet->order_id = (uint64_t)order_id;
+    return 0;
+}
+
+/* Shared parsing/building for the session-start scale announcement. */
+static int parse_symbol_config(PyObject* args, PyObject* kwargs,
+                               MarketDataPacketWire* packet) {
+    const char* symbol = NULL;
+    Py_ssize_t symbol_len = 0;
+    unsigned long long price_scale = QF_DEFAULT_PRICE_SCALE;
+    unsigned long long qty_scale = QF_DEFAULT_QTY_SCALE;
+    unsigned long long timestamp_ns = 0;
+    static char* kwlist[] = {"symbol", "price_scale", "qty_scale", "timestamp_ns", NULL};
     if (!PyArg_ParseTupleAndKeywords(
-            args, kwargs, "s#iddK|KK", kwlist, &symbol, &symbol_len, &side, &price, &size,
-            &timestamp_ns, &order_id, &qty_scale)) {
+            args, kwargs, "s#|KKK", kwlist, &symbol, &symbol_len, &price_scale,
+            &qty_scale, &timestamp_ns)) {
+        return -1;
+    }
+
+    memset(packet, 0, sizeof(*packet));
+    copy_symbol(packet->symbol, symbol, symbol_len);
+    packet->event_type = QF_EVENT_SYMBOL_CONFIG;
+    packet->price = (uint64_t)price_scale;
+    packet->quantity = (uint64_t)qty_scale;
+    packet->timestamp_ns = (uint64_t)timestamp_ns;
+    return 0;
+}
+
+static PyObject* UdsBridgeSender_send_trade(UdsBridgeSenderObject* self, PyObject* args, PyObject* kwargs) {
+    MarketDataPacketWire packet;
+    if (parse_trade(args, kwargs, &packet) != 0) {
         return NULL;
     }
 
+    Py_BEGIN_ALLOW_THREADS
+    (void)send_packet(self, &packet);
+    Py_END_ALLOW_THREADS
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* UdsBridgeSender_send_symbol_config(UdsBridgeSenderObject* self, PyObject* args, PyObject* kwargs) {
     MarketDataPacketWire packet;
-    memset(&packet, 0, sizeof(packet));
-    copy_symbol(packet.symbol, symbol, symbol_len);
-    packet.side = side == 0 ? 0 : 1;
-    packet.event_type = 1;
-    packet.price = price;
-    packet.quantity = to_scaled_qty(size, (uint64_t)qty_scale);
-    packet.timestamp_ns = (uint64_t)timestamp_ns;
-    packet.order_id = (uint64_t)order_id;
+    if (parse_symbol_config(args, kwargs, &packet) != 0) {
+        return NULL;
+    }
 
     Py_BEGIN_ALLOW_THREADS
     (void)send_packet(self, &packet);
@@ -243,22 +403,54 @@ static PyObject* UdsBridgeSender_send_book(UdsBridgeSenderObject* self, PyObject
     PyObject* asks = NULL;
     unsigned long long timestamp_ns = 0;
     unsigned long long qty_scale = QF_DEFAULT_QTY_SCALE;
-    static char* kwlist[] = {"symbol", "bids", "asks", "timestamp_ns", "qty_scale", NULL};
+    unsigned long long price_scale = QF_DEFAULT_PRICE_SCALE;
+    static char* kwlist[] = {"symbol", "bids", "asks", "timestamp_ns", "qty_scale",
+                             "price_scale", NULL};
     if (!PyArg_ParseTupleAndKeywords(
-            args, kwargs, "s#OOK|K", kwlist, &symbol, &symbol_len, &bids, &asks,
-            &timestamp_ns, &qty_scale)) {
+            args, kwargs, "s#OOK|KK", kwlist, &symbol, &symbol_len, &bids, &asks,
+            &timestamp_ns, &qty_scale, &price_scale)) {
         return NULL;
     }
 
-    if (send_levels(self, symbol, symbol_len, bids, 0, (uint64_t)timestamp_ns, (uint64_t)qty_scale) != 0) {
+    if (send_levels(self, uds_emit_packet, symbol, symbol_len, bids, 0,
+                    (uint64_t)timestamp_ns, (uint64_t)price_scale,
+                    (uint64_t)qty_scale) != 0) {
         return NULL;
     }
-    if (send_levels(self, symbol, symbol_len, asks, 1, (uint64_t)timestamp_ns, (uint64_t)qty_scale) != 0) {
+    if (send_levels(self, uds_emit_packet, symbol, symbol_len, asks, 1,
+                    (uint64_t)timestamp_ns, (uint64_t)price_scale,
+                    (uint64_t)qty_scale) != 0) {
         return NULL;
     }
     Py_RETURN_NONE;
 }
 
+static PyObject* UdsBridgeSender_send_order_event(
+    UdsBridgeSenderObject* self, PyObject* args, PyObject* kwargs, uint8_t event_type) {
+    MarketDataPacketWire packet;
+    if (parse_order_event(args, kwargs, event_type, &packet) != 0) {
+        return NULL;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    (void)send_packet(self, &packet);
+    Py_END_ALLOW_THREADS
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* UdsBridgeSender_send_order(UdsBridgeSenderObject* self, PyObject* args, PyObject* kwargs) {
+    return UdsBridgeSender_send_order_event(self, args, kwargs, QF_EVENT_ORDER_ADD);
+}
+
+static PyObject* UdsBridgeSender_send_cancel(UdsBridgeSenderObject* self, PyObject* args, PyObject* kwargs) {
+    return UdsBridgeSender_send_order_event(self, args, kwargs, QF_EVENT_ORDER_CANCEL);
+}
+
+static PyObject* UdsBridgeSender_send_modify(UdsBridgeSenderObject* self, PyObject* args, PyObject* kwargs) {
+    return UdsBridgeSender_send_order_event(self, args, kwargs, QF_EVENT_ORDER_MODIFY);
+}
+
 static PyObject* UdsBridgeSender_stats(UdsBridgeSenderObject* self, PyObject* Py_UNUSED(ignored)) {
     PyObject* d = PyDict_New();
     if (d == NULL) {
@@ -301,6 +493,10 @@ static PyObject* UdsBridgeSender_close(UdsBridgeSenderObject* self, PyObject* Py
 static PyMethodDef UdsBridgeSender_methods[] = {
     {"send_book", (PyCFunction)UdsBridgeSender_send_book, METH_VARARGS | METH_KEYWORDS, "Send book levels"},
     {"send_trade", (PyCFunction)UdsBridgeSender_send_trade, METH_VARARGS | METH_KEYWORDS, "Send trade packet"},
+    {"send_symbol_config", (PyCFunction)UdsBridgeSender_send_symbol_config, METH_VARARGS | METH_KEYWORDS, "Announce per-symbol price/qty scales"},
+    {"send_order", (PyCFunction)UdsBridgeSender_send_order, METH_VARARGS | METH_KEYWORDS, "Send L3 order add"},
+    {"send_cancel", (PyCFunction)UdsBridgeSender_send_cancel, METH_VARARGS | METH_KEYWORDS, "Send L3 order cancel"},
+    {"send_modify", (PyCFunction)UdsBridgeSender_send_modify, METH_VARARGS | METH_KEYWORDS, "Send L3 order modify"},
     {"stats", (PyCFunction)UdsBridgeSender_stats, METH_NOARGS, "Return sender stats"},
     {"close", (PyCFunction)UdsBridgeSender_close, METH_NOARGS, "Close socket"},
     {NULL, NULL, 0, NULL}
@@ -318,6 +514,247 @@ static PyTypeObject UdsBridgeSenderType = {
     .tp_new = PyType_GenericNew,
 };
 
+/* ------------------------------------------------------------------ */
+/* ShmBridgeSender: zero-syscall producer into the shared-memory ring.
+ * The C++ engine creates and initializes the segment (see shm_bridge.hpp);
+ * this side only attaches and validates the header. */
+/* ------------------------------------------------------------------ */
+
+typedef struct {
+    PyObject_HEAD
+    QfShmRingHeader* header;
+    QfShmRingPacket* packets;
+    uint64_t mask;
+    size_t mapped_size;
+    char ring_name[256];
+    uint64_t sent;
+    uint64_t dropped;
+} ShmBridgeSenderObject;
+
+static void shm_sender_detach(ShmBridgeSenderObject* self) {
+    if (self->header != NULL) {
+        munmap(self->header, self->mapped_size);
+        self->header = NULL;
+        self->packets = NULL;
+        self->mapped_size = 0;
+        self->mask = 0;
+    }
+}
+
+static int shm_emit_packet(void* sender, const MarketDataPacketWire* packet) {
+    ShmBridgeSenderObject* self = (ShmBridgeSenderObject*)sender;
+    if (self->header == NULL) {
+        self->dropped++;
+        return -1;
+    }
+
+    uint64_t tail = __atomic_load_n(&self->header->tail, __ATOMIC_RELAXED);
+    uint64_t next = (tail + 1) & self->mask;
+    if (next == __atomic_load_n(&self->header->head, __ATOMIC_ACQUIRE)) {
+        __atomic_fetch_add(&self->header->drop_count, 1, __ATOMIC_RELAXED);
+        self->dropped++;
+        return -1;
+    }
+
+    memcpy(&self->packets[tail], packet, sizeof(*packet));
+    __atomic_store_n(&self->header->tail, next, __ATOMIC_RELEASE);
+    __atomic_fetch_add(&self->header->push_count, 1, __ATOMIC_RELAXED);
+    self->sent++;
+    return 0;
+}
+
+static int ShmBridgeSender_init(ShmBridgeSenderObject* self, PyObject* args, PyObject* kwargs) {
+    const char* ring_name = QF_SHM_RING_DEFAULT_NAME;
+    static char* kwlist[] = {"ring_name", NULL};
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|s", kwlist, &ring_name)) {
+        return -1;
+    }
+
+    memset(self->ring_name, 0, sizeof(self->ring_name));
+    if (strlen(ring_name) >= sizeof(self->ring_name)) {
+        PyErr_SetString(PyExc_ValueError, "Shm ring name too long");
+        return -1;
+    }
+    snprintf(self->ring_name, sizeof(self->ring_name), "%s", ring_name);
+    self->header = NULL;
+    self->packets = NULL;
+    self->sent = 0;
+    self->dropped = 0;
+
+    int fd = shm_open(ring_name, O_RDWR, 0);
+    if (fd < 0) {
+        PyErr_Format(PyExc_RuntimeError,
+                     "Shm ring %s not available (start the C++ engine first): %s",
+                     ring_name, strerror(errno));
+        return -1;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(QfShmRingHeader)) {
+        close(fd);
+        PyErr_Format(PyExc_RuntimeError, "Shm ring %s has invalid size", ring_name);
+        return -1;
+    }
+
+    void* base = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        PyErr_Format(PyExc_RuntimeError, "Failed to map shm ring %s: %s",
+                     ring_name, strerror(errno));
+        return -1;
+    }
+
+    QfShmRingHeader* header = (QfShmRingHeader*)base;
+    uint32_t magic = __atomic_load_n(&header->magic, __ATOMIC_ACQUIRE);
+    if (magic != QF_SHM_RING_MAGIC || header->version != QF_SHM_RING_VERSION ||
+        header->capacity < 2 || (header->capacity & (header->capacity - 1)) != 0 ||
+        (uint64_t)st.st_size < QF_SHM_RING_TOTAL_SIZE(header->capacity)) {
+        munmap(base, (size_t)st.st_size);
+        PyErr_Format(PyExc_RuntimeError, "Shm ring %s has an incompatible header", ring_name);
+        return -1;
+    }
+
+    self->header = header;
+    self->packets = (QfShmRingPacket*)((char*)base + QF_SHM_RING_DATA_OFFSET);
+    self->mask = header->capacity - 1;
+    self->mapped_size = (size_t)st.st_size;
+    return 0;
+}
+
+static void ShmBridgeSender_dealloc(ShmBridgeSenderObject* self) {
+    shm_sender_detach(self);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static PyObject* ShmBridgeSender_send_trade(ShmBridgeSenderObject* self, PyObject* args, PyObject* kwargs) {
+    MarketDataPacketWire packet;
+    if (parse_trade(args, kwargs, &packet) != 0) {
+        return NULL;
+    }
+    (void)shm_emit_packet(self, &packet);
+    Py_RETURN_NONE;
+}
+
+static PyObject* ShmBridgeSender_send_symbol_config(ShmBridgeSenderObject* self, PyObject* args, PyObject* kwargs) {
+    MarketDataPacketWire packet;
+    if (parse_symbol_config(args, kwargs, &packet) != 0) {
+        return NULL;
+    }
+    (void)shm_emit_packet(self, &packet);
+    Py_RETURN_NONE;
+}
+
+static PyObject* ShmBridgeSender_send_book(ShmBridgeSenderObject* self, PyObject* args, PyObject* kwargs) {
+    const char* symbol = NULL;
+    Py_ssize_t symbol_len = 0;
+    PyObject* bids = NULL;
+    PyObject* asks = NULL;
+    unsigned long long timestamp_ns = 0;
+    unsigned long long qty_scale = QF_DEFAULT_QTY_SCALE;
+    unsigned long long price_scale = QF_DEFAULT_PRICE_SCALE;
+    static char* kwlist[] = {"symbol", "bids", "asks", "timestamp_ns", "qty_scale",
+                             "price_scale", NULL};
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwargs, "s#OOK|KK", kwlist, &symbol, &symbol_len, &bids, &asks,
+            &timestamp_ns, &qty_scale, &price_scale)) {
+        return NULL;
+    }
+
+    if (send_levels(self, shm_emit_packet, symbol, symbol_len, bids, 0,
+                    (uint64_t)timestamp_ns, (uint64_t)price_scale,
+                    (uint64_t)qty_scale) != 0) {
+        return NULL;
+    }
+    if (send_levels(self, shm_emit_packet, symbol, symbol_len, asks, 1,
+                    (uint64_t)timestamp_ns, (uint64_t)price_scale,
+                    (uint64_t)qty_scale) != 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject* ShmBridgeSender_send_order_event(
+    ShmBridgeSenderObject* self, PyObject* args, PyObject* kwargs, uint8_t event_type) {
+    MarketDataPacketWire packet;
+    if (parse_order_event(args, kwargs, event_type, &packet) != 0) {
+        return NULL;
+    }
+    (void)shm_emit_packet(self, &packet);
+    Py_RETURN_NONE;
+}
+
+static PyObject* ShmBridgeSender_send_order(ShmBridgeSenderObject* self, PyObject* args, PyObject* kwargs) {
+    return ShmBridgeSender_send_order_event(self, args, kwargs, QF_EVENT_ORDER_ADD);
+}
+
+static PyObject* ShmBridgeSender_send_cancel(ShmBridgeSenderObject* self, PyObject* args, PyObject* kwargs) {
+    return ShmBridgeSender_send_order_event(self, args, kwargs, QF_EVENT_ORDER_CANCEL);
+}
+
+static PyObject* ShmBridgeSender_send_modify(ShmBridgeSenderObject* self, PyObject* args, PyObject* kwargs) {
+    return ShmBridgeSender_send_order_event(self, args, kwargs, QF_EVENT_ORDER_MODIFY);
+}
+
+static PyObject* ShmBridgeSender_stats(ShmBridgeSenderObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* d = PyDict_New();
+    if (d == NULL) {
+        return NULL;
+    }
+    PyObject* sent = PyLong_FromUnsignedLongLong(self->sent);
+    PyObject* dropped = PyLong_FromUnsignedLongLong(self->dropped);
+    PyObject* path = PyUnicode_FromString(self->ring_name);
+    PyObject* active = PyBool_FromLong(self->header != NULL ? 1 : 0);
+
+    if (sent == NULL || dropped == NULL || path == NULL || active == NULL) {
+        Py_XDECREF(sent);
+        Py_XDECREF(dropped);
+        Py_XDECREF(path);
+        Py_XDECREF(active);
+        Py_DECREF(d);
+        return NULL;
+    }
+
+    PyDict_SetItemString(d, "sent", sent);
+    PyDict_SetItemString(d, "dropped", dropped);
+    PyDict_SetItemString(d, "socket_path", path);
+    PyDict_SetItemString(d, "active", active);
+
+    Py_DECREF(sent);
+    Py_DECREF(dropped);
+    Py_DECREF(path);
+    Py_DECREF(active);
+    return d;
+}
+
+static PyObject* ShmBridgeSender_close(ShmBridgeSenderObject* self, PyObject* Py_UNUSED(ignored)) {
+    shm_sender_detach(self);
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef ShmBridgeSender_methods[] = {
+    {"send_book", (PyCFunction)ShmBridgeSender_send_book, METH_VARARGS | METH_KEYWORDS, "Send book levels"},
+    {"send_trade", (PyCFunction)ShmBridgeSender_send_trade, METH_VARARGS | METH_KEYWORDS, "Send trade packet"},
+    {"send_symbol_config", (PyCFunction)ShmBridgeSender_send_symbol_config, METH_VARARGS | METH_KEYWORDS, "Announce per-symbol price/qty scales"},
+    {"send_order", (PyCFunction)ShmBridgeSender_send_order, METH_VARARGS | METH_KEYWORDS, "Send L3 order add"},
+    {"send_cancel", (PyCFunction)ShmBridgeSender_send_cancel, METH_VARARGS | METH_KEYWORDS, "Send L3 order cancel"},
+    {"send_modify", (PyCFunction)ShmBridgeSender_send_modify, METH_VARARGS | METH_KEYWORDS, "Send L3 order modify"},
+    {"stats", (PyCFunction)ShmBridgeSender_stats, METH_NOARGS, "Return sender stats"},
+    {"close", (PyCFunction)ShmBridgeSender_close, METH_NOARGS, "Detach from shm ring"},
+    {NULL, NULL, 0, NULL}
+};
+
+static PyTypeObject ShmBridgeSenderType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "quantumflow_uds_bridge.ShmBridgeSender",
+    .tp_basicsize = sizeof(ShmBridgeSenderObject),
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = "Shared-memory ring sender (zero syscalls per packet)",
+    .tp_methods = ShmBridgeSender_methods,
+    .tp_init = (initproc)ShmBridgeSender_init,
+    .tp_dealloc = (destructor)ShmBridgeSender_dealloc,
+    .tp_new = PyType_GenericNew,
+};
+
 static PyMethodDef module_methods[] = {
     {NULL, NULL, 0, NULL}
 };
@@ -334,6 +771,9 @@ PyMODINIT_FUNC PyInit_quantumflow_uds_bridge(void) {
     if (PyType_Ready(&UdsBridgeSenderType) < 0) {
         return NULL;
     }
+    if (PyType_Ready(&ShmBridgeSenderType) < 0) {
+        return NULL;
+    }
 
     PyObject* m = PyModule_Create(&module_def);
     if (m == NULL) {
@@ -346,5 +786,12 @@ PyMODINIT_FUNC PyInit_quantumflow_uds_bridge(void) {
         Py_DECREF(m);
         return NULL;
     }
+
+    Py_INCREF(&ShmBridgeSenderType);
+    if (PyModule_AddObject(m, "ShmBridgeSender", (PyObject*)&ShmBridgeSenderType) != 0) {
+        Py_DECREF(&ShmBridgeSenderType);
+        Py_DECREF(m);
+        return NULL;
+    }
     return m;
 }
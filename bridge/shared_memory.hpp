@@ -1,49 +1,166 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include "common/market_data_packet.hpp"
+#include "common/wait_strategy.hpp"
 #include "memory/allocator.h"
 
 namespace quantumflow {
 
-/// Thread-safe bridge wrapping the lock-free ring buffer for Python→C++ market data transfer.
-/// Uses SPSC (single producer, single consumer) pattern:
-///   Producer: Python pipeline
-///   Consumer: C++ main loop
+/// Thread-safe bridge wrapping lock-free ring buffers for PythonâC++ market
+/// data transfer. Each registered producer owns a dedicated SPSC ring, so
+/// every ring keeps its single-writer/single-reader guarantees while the
+/// consumer fans in across rings round-robin:
+///   Producers: one per ingest process/thread (slot 0 is pre-registered and
+///              backs the original single-producer push() API)
+///   Consumer:  C++ main loop
 class MarketDataBridge {
 public:
     static constexpr size_t CAPACITY = 4096;
+    static constexpr size_t MAX_PRODUCERS = 8;
 
-    bool push(const MarketDataPacket& packet) {
-        bool ok = ring_.tryPush(packet);
+    /// Claim a producer slot and get the id to pass to push()/push_batch().
+    /// Returns -1 when all slots are taken. Slot 0 exists from construction.
+    int register_producer() {
+        size_t id = producer_count_.fetch_add(1, std::memory_order_acq_rel);
+        if (id >= MAX_PRODUCERS) {
+            producer_count_.fetch_sub(1, std::memory_order_acq_rel);
+            return -1;
+        }
+        return static_cast<int>(id);
+    }
+
+    size_t producer_count() const {
+        return producer_count_.load(std::memory_order_acquire);
+    }
+
+    bool push(const MarketDataPacket& packet) { return push(0, packet); }
+
+    bool push(int producer, const MarketDataPacket& packet) {
+        Producer& p = producers_[static_cast<size_t>(producer)];
+        bool ok = p.ring.tryPush(packet);
         if (ok) {
-            push_count_.fetch_add(1, std::memory_order_relaxed);
+            p.push_count.fetch_add(1, std::memory_order_relaxed);
         } else {
-            drop_count_.fetch_add(1, std::memory_order_relaxed);
+            p.drop_count.fetch_add(1, std::memory_order_relaxed);
         }
         return ok;
     }
 
+    /// Bulk transfer: one ring index update per batch instead of per packet.
+    /// Returns how many packets were actually pushed; the rest are dropped.
+    size_t push_batch(const MarketDataPacket* packets, size_t count) {
+        return push_batch(0, packets, count);
+    }
+
+    size_t push_batch(int producer, const MarketDataPacket* packets, size_t count) {
+        Producer& p = producers_[static_cast<size_t>(producer)];
+        size_t n = p.ring.tryPushN(packets, count);
+        if (n > 0) {
+            p.push_count.fetch_add(n, std::memory_order_relaxed);
+        }
+        if (n < count) {
+            p.drop_count.fetch_add(count - n, std::memory_order_relaxed);
+        }
+        return n;
+    }
+
+    /// Consumer side: round-robins the registered rings so one busy feed
+    /// cannot starve the others.
     bool pop(MarketDataPacket& packet) {
-        bool ok = ring_.tryPop(packet);
-        if (ok) {
-            pop_count_.fetch_add(1, std::memory_order_relaxed);
+        const size_t n = producer_count();
+        for (size_t i = 0; i < n; ++i) {
+            const size_t idx = next_ring_;
+            next_ring_ = (next_ring_ + 1 < n) ? next_ring_ + 1 : 0;
+            if (producers_[idx].ring.tryPop(packet)) {
+                pop_count_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
         }
-        return ok;
+        return false;
+    }
+
+    /// Blocking pop for dedicated consumer threads: polls the rings under
+    /// the caller's wait strategy until a packet arrives, so a quiet
+    /// stretch escalates spin -> yield -> sleep instead of hammering the
+    /// rings or eating a fixed sleep on the first packet after a lull.
+    bool pop_wait(MarketDataPacket& packet, WaitStrategy& wait) {
+        while (!pop(packet)) {
+            wait.idle();
+        }
+        wait.reset();
+        return true;
     }
 
-    uint64_t push_count() const { return push_count_.load(std::memory_order_relaxed); }
+    /// Pops up to count packets into the caller's buffer, draining rings
+    /// round-robin.
+    size_t pop_batch(MarketDataPacket* packets, size_t count) {
+        const size_t rings = producer_count();
+        size_t total = 0;
+        for (size_t i = 0; i < rings && total < count; ++i) {
+            const size_t idx = next_ring_;
+            next_ring_ = (next_ring_ + 1 < rings) ? next_ring_ + 1 : 0;
+            total += producers_[idx].ring.tryPopN(packets + total, count - total);
+        }
+        if (total > 0) {
+            pop_count_.fetch_add(total, std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    /// Aggregate counters across all producers (legacy accessors).
+    uint64_t push_count() const { return sum(&Producer::push_count); }
+    uint64_t drop_count() const { return sum(&Producer::drop_count); }
     uint64_t pop_count()  const { return pop_count_.load(std::memory_order_relaxed); }
-    uint64_t drop_count() const { return drop_count_.load(std::memory_order_relaxed); }
 
-    bool empty() const { return ring_.empty(); }
-    size_t size() const { return ring_.size(); }
+    /// Per-producer counters, for spotting which feed is dropping.
+    uint64_t push_count(int producer) const {
+        return producers_[static_cast<size_t>(producer)]
+            .push_count.load(std::memory_order_relaxed);
+    }
+    uint64_t drop_count(int producer) const {
+        return producers_[static_cast<size_t>(producer)]
+            .drop_count.load(std::memory_order_relaxed);
+    }
+
+    bool empty() const {
+        const size_t n = producer_count();
+        for (size_t i = 0; i < n; ++i) {
+            if (!producers_[i].ring.empty()) return false;
+        }
+        return true;
+    }
+
+    size_t size() const {
+        const size_t n = producer_count();
+        size_t total = 0;
+        for (size_t i = 0; i < n; ++i) {
+            total += producers_[i].ring.size();
+        }
+        return total;
+    }
 
 private:
-    engine::memory::fast::LockFreeRingBuffer<MarketDataPacket, CAPACITY> ring_;
-    std::atomic<uint64_t> push_count_{0};
+    struct Producer {
+        engine::memory::fast::LockFreeRingBuffer<MarketDataPacket, CAPACITY> ring;
+        std::atomic<uint64_t> push_count{0};
+        std::atomic<uint64_t> drop_count{0};
+    };
+
+    uint64_t sum(std::atomic<uint64_t> Producer::* field) const {
+        const size_t n = producer_count();
+        uint64_t total = 0;
+        for (size_t i = 0; i < n; ++i) {
+            total += (producers_[i].*field).load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    std::array<Producer, MAX_PRODUCERS> producers_;
+    std::atomic<size_t> producer_count_{1}; // slot 0 is the default producer
     std::atomic<uint64_t> pop_count_{0};
-    std::atomic<uint64_t> drop_count_{0};
+    size_t next_ring_ = 0; // consumer-only round-robin cursor
 };
 
 /// Global bridge instance shared between Python ingress and the C++ main loop.
@@ -0,0 +1,245 @@
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "common/market_data_packet.hpp"
+#include "bridge/shm_ring.h"
+
+namespace quantumflow {
+
+static_assert(sizeof(QfShmRingPacket) == sizeof(MarketDataPacket),
+              "Shared-memory wire packet must match MarketDataPacket layout");
+
+/// Cross-process SPSC bridge backed by a POSIX shared-memory ring.
+/// Same push/pop API as MarketDataBridge, but producer and consumer live
+/// in different processes and no syscall is made per packet:
+///   Producer: Python pipeline (via quantumflow_uds_bridge ShmBridgeSender)
+///   Consumer: C++ main loop
+/// The consumer owns the segment lifecycle (create_and_init / close_and_unlink).
+class ShmMarketDataBridge {
+public:
+    ShmMarketDataBridge() = default;
+
+    ~ShmMarketDataBridge() {
+        close_and_unlink();
+    }
+
+    ShmMarketDataBridge(const ShmMarketDataBridge&) = delete;
+    ShmMarketDataBridge& operator=(const ShmMarketDataBridge&) = delete;
+
+    /// Consumer side: create (or recreate) the named segment, size it for
+    /// `capacity` packets and publish an initialized header. Returns false
+    /// on any syscall failure; the caller falls back to the UDS path.
+    bool create_and_init(const std::string& name = QF_SHM_RING_DEFAULT_NAME,
+                         uint64_t capacity = QF_SHM_RING_DEFAULT_CAPACITY) {
+        if (header_) return true;
+        if (capacity < 2 || (capacity & (capacity - 1)) != 0) {
+            std::fprintf(stderr, "Shm ring capacity must be a power of two >= 2\n");
+            return false;
+        }
+
+        int fd = ::shm_open(name.c_str(), O_CREAT | O_RDWR, 0666);
+        if (fd < 0) {
+            std::fprintf(stderr, "Failed to open shm ring %s: %s\n",
+                         name.c_str(), std::strerror(errno));
+            return false;
+        }
+
+        const uint64_t total = QF_SHM_RING_TOTAL_SIZE(capacity);
+        if (::ftruncate(fd, static_cast<off_t>(total)) != 0) {
+            std::fprintf(stderr, "Failed to size shm ring %s: %s\n",
+                         name.c_str(), std::strerror(errno));
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            return false;
+        }
+
+        void* base = ::mmap(nullptr, total, PROT_READ | PROT_WRITE,
+                            MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            std::fprintf(stderr, "Failed to map shm ring %s: %s\n",
+                         name.c_str(), std::strerror(errno));
+            ::shm_unlink(name.c_str());
+            return false;
+        }
+
+        name_ = name;
+        mapped_size_ = total;
+        header_ = static_cast<QfShmRingHeader*>(base);
+        packets_ = reinterpret_cast<MarketDataPacket*>(
+            static_cast<char*>(base) + QF_SHM_RING_DATA_OFFSET);
+        mask_ = capacity - 1;
+
+        // Fresh session: reset indices/counters from any previous run, then
+        // publish the magic last so producers never see a half-built header.
+        header_->version = QF_SHM_RING_VERSION;
+        header_->capacity = capacity;
+        header_->tail = 0;
+        header_->head = 0;
+        header_->push_count = 0;
+        header_->drop_count = 0;
+        header_->pop_count = 0;
+        std::atomic_ref<uint32_t>(header_->magic)
+            .store(QF_SHM_RING_MAGIC, std::memory_order_release);
+        return true;
+    }
+
+    bool is_open() const { return header_ != nullptr; }
+    const std::string& name() const { return name_; }
+
+    /// In-process producer path (used by tests; the real producer is the
+    /// C extension writing the same layout from the Python process).
+    bool push(const MarketDataPacket& packet) {
+        if (!header_) return false;
+        std::atomic_ref<uint64_t> tail(header_->tail);
+        std::atomic_ref<uint64_t> head(header_->head);
+
+        uint64_t t = tail.load(std::memory_order_relaxed);
+        uint64_t next = (t + 1) & mask_;
+        if (next == head.load(std::memory_order_acquire)) {
+            std::atomic_ref<uint64_t>(header_->drop_count)
+                .fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        packets_[t] = packet;
+        tail.store(next, std::memory_order_release);
+        std::atomic_ref<uint64_t>(header_->push_count)
+            .fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool pop(MarketDataPacket& packet) {
+        if (!header_) return false;
+        std::atomic_ref<uint64_t> tail(header_->tail);
+        std::atomic_ref<uint64_t> head(header_->head);
+
+        uint64_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        packet = packets_[h];
+        head.store((h + 1) & mask_, std::memory_order_release);
+        std::atomic_ref<uint64_t>(header_->pop_count)
+            .fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    uint64_t push_count() const { return counter(&QfShmRingHeader::push_count); }
+    uint64_t pop_count()  const { return counter(&QfShmRingHeader::pop_count); }
+    uint64_t drop_count() const { return counter(&QfShmRingHeader::drop_count); }
+
+    bool empty() const { return size() == 0; }
+
+    size_t size() const {
+        if (!header_) return 0;
+        uint64_t h = std::atomic_ref<uint64_t>(header_->head)
+                         .load(std::memory_order_relaxed);
+        uint64_t t = std::atomic_ref<uint64_t>(header_->tail)
+                         .load(std::memory_order_relaxed);
+        return static_cast<size_t>((t - h) & mask_);
+    }
+
+    void close_and_unlink() {
+        if (!header_) return;
+        ::munmap(header_, mapped_size_);
+        ::shm_unlink(name_.c_str());
+        header_ = nullptr;
+        packets_ = nullptr;
+        mapped_size_ = 0;
+        mask_ = 0;
+    }
+
+private:
+    uint64_t counter(uint64_t QfShmRingHeader::* field) const {
+        if (!header_) return 0;
+        return std::atomic_ref<uint64_t>(header_->*field)
+            .load(std::memory_order_relaxed);
+    }
+
+    QfShmRingHeader* header_ = nullptr;
+    MarketDataPacket* packets_ = nullptr;
+    size_t mapped_size_ = 0;
+    uint64_t mask_ = 0;
+    std::string name_;
+};
+
+/// Fan-in over one shared-memory ring per producer process, mirroring the
+/// in-process MPSC bridge: each ingest process keeps its own SPSC ring and
+/// the consumer round-robins across them. Ring 0 keeps the configured base
+/// name so existing single-producer senders work unchanged; ring i > 0 is
+/// named "<base>.<i>" and each extra ingest process passes that name to its
+/// ShmBridgeSender.
+class ShmBridgeFanIn {
+public:
+    static constexpr size_t MAX_RINGS = 8;
+
+    bool create_and_init(const std::string& base_name,
+                         size_t producers = 1,
+                         uint64_t capacity = QF_SHM_RING_DEFAULT_CAPACITY) {
+        if (producers == 0) producers = 1;
+        if (producers > MAX_RINGS) producers = MAX_RINGS;
+
+        for (size_t i = 0; i < producers; ++i) {
+            const std::string name =
+                (i == 0) ? base_name : base_name + "." + std::to_string(i);
+            if (!rings_[i].create_and_init(name, capacity)) {
+                close_and_unlink();
+                return false;
+            }
+        }
+        count_ = producers;
+        return true;
+    }
+
+    bool is_open() const { return count_ > 0; }
+    size_t ring_count() const { return count_; }
+
+    /// Per-producer ring, for reading individual feed counters.
+    const ShmMarketDataBridge& ring(size_t i) const { return rings_[i]; }
+
+    bool pop(MarketDataPacket& packet) {
+        for (size_t i = 0; i < count_; ++i) {
+            const size_t idx = next_;
+            next_ = (next_ + 1 < count_) ? next_ + 1 : 0;
+            if (rings_[idx].pop(packet)) return true;
+        }
+        return false;
+    }
+
+    uint64_t push_count() const { return sum(&ShmMarketDataBridge::push_count); }
+    uint64_t pop_count()  const { return sum(&ShmMarketDataBridge::pop_count); }
+    uint64_t drop_count() const { return sum(&ShmMarketDataBridge::drop_count); }
+
+    void close_and_unlink() {
+        for (size_t i = 0; i < MAX_RINGS; ++i) {
+            rings_[i].close_and_unlink();
+        }
+        count_ = 0;
+        next_ = 0;
+    }
+
+private:
+    uint64_t sum(uint64_t (ShmMarketDataBridge::* counter)() const) const {
+        uint64_t total = 0;
+        for (size_t i = 0; i < count_; ++i) {
+            total += (rings_[i].*counter)();
+        }
+        return total;
+    }
+
+    ShmMarketDataBridge rings_[MAX_RINGS];
+    size_t count_ = 0;
+    size_t next_ = 0; // consumer-only round-robin cursor
+};
+
+} // namespace quantumflow
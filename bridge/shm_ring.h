@@ -0,0 +1,69 @@
+#ifndef QUANTUMFLOW_BRIDGE_SHM_RING_H
+#define QUANTUMFLOW_BRIDGE_SHM_RING_H
+
+/*
+ * Shared-memory SPSC ring layout for Python->C++ market data transfer.
+ *
+ * This header is included from both the C producer extension
+ * (quantumflow_uds_bridge_capi.c) and the C++ consumer (shm_bridge.hpp),
+ * so it must remain valid C and define the exact on-disk layout.
+ *
+ * Layout: one QfShmRingHeader at offset 0, followed by capacity packets.
+ * The consumer (C++ engine) owns the segment: it creates, sizes and
+ * initializes it, then publishes the magic with a release store. Producers
+ * attach read-write and must validate magic/version/capacity before use.
+ *
+ * Ring convention matches engine::memory::fast::LockFreeRingBuffer:
+ * tail is the producer write index, head is the consumer read index,
+ * capacity is a power of two and one slot is always left empty.
+ */
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+#define QF_SHM_ALIGN(x) alignas(x)
+#else
+#define QF_SHM_ALIGN(x) _Alignas(x)
+#endif
+
+#define QF_SHM_RING_MAGIC            0x51464d52u /* "QFMR" */
+#define QF_SHM_RING_VERSION          1u
+#define QF_SHM_RING_DEFAULT_NAME     "/quantumflow_md_ring"
+#define QF_SHM_RING_DEFAULT_CAPACITY 65536u /* packets; must be a power of two */
+
+/* Must match the layout of quantumflow::MarketDataPacket exactly. */
+typedef struct QfShmRingPacket {
+    char symbol[16];
+    uint8_t side;        /* 0 = buy, 1 = sell */
+    uint8_t event_type;  /* 0 = book_level, 1 = trade, 2 = order_add,
+                          * 3 = order_cancel, 4 = order_modify,
+                          * 5 = symbol_config, 6 = book_checksum */
+    uint8_t _padding[6];
+    uint64_t price;      /* integer ticks (scale via symbol_config) */
+    uint64_t quantity;
+    uint64_t timestamp_ns;
+    uint64_t order_id;
+} QfShmRingPacket;
+
+typedef struct QfShmRingHeader {
+    uint32_t magic;    /* QF_SHM_RING_MAGIC once initialized */
+    uint32_t version;  /* QF_SHM_RING_VERSION */
+    uint64_t capacity; /* number of packet slots (power of two) */
+
+    /* Producer and consumer indices on separate cache lines to avoid
+     * false sharing across the process boundary. */
+    QF_SHM_ALIGN(64) uint64_t tail; /* written by producer */
+    QF_SHM_ALIGN(64) uint64_t head; /* written by consumer */
+
+    QF_SHM_ALIGN(64) uint64_t push_count; /* producer-side counters */
+    uint64_t drop_count;
+    QF_SHM_ALIGN(64) uint64_t pop_count;  /* consumer-side counter */
+} QfShmRingHeader;
+
+/* Packet slots start immediately after the (cache-line padded) header. */
+#define QF_SHM_RING_DATA_OFFSET sizeof(QfShmRingHeader)
+
+#define QF_SHM_RING_TOTAL_SIZE(capacity) \
+    (QF_SHM_RING_DATA_OFFSET + (uint64_t)(capacity) * sizeof(QfShmRingPacket))
+
+#endif /* QUANTUMFLOW_BRIDGE_SHM_RING_H */
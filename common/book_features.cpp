@@ -0,0 +1,121 @@
+#include "common/book_features.hpp"
+
+#include "strategies/strategy_base.hpp"
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace quantumflow {
+
+void BookSideSoA::assign(const std::vector<PriceLevel>& side) {
+    prices.resize(side.size());
+    volumes.resize(side.size());
+    for (size_t i = 0; i < side.size(); ++i) {
+        prices[i] = side[i].price;
+        volumes[i] = static_cast<double>(side[i].quantity);
+    }
+}
+
+namespace features {
+
+#if defined(__AVX512F__)
+
+double sum(const double* values, size_t n) {
+    __m512d acc = _mm512_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc = _mm512_add_pd(acc, _mm512_loadu_pd(values + i));
+    }
+    double total = _mm512_reduce_add_pd(acc);
+    for (; i < n; ++i) total += values[i];
+    return total;
+}
+
+double dot(const double* a, const double* b, size_t n) {
+    __m512d acc = _mm512_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc = _mm512_fmadd_pd(_mm512_loadu_pd(a + i),
+                              _mm512_loadu_pd(b + i), acc);
+    }
+    double total = _mm512_reduce_add_pd(acc);
+    for (; i < n; ++i) total += a[i] * b[i];
+    return total;
+}
+
+#elif defined(__AVX2__)
+
+namespace {
+
+inline double reduce_add(__m256d v) {
+    __m128d lo = _mm256_castpd256_pd128(v);
+    __m128d hi = _mm256_extractf128_pd(v, 1);
+    lo = _mm_add_pd(lo, hi);
+    return _mm_cvtsd_f64(_mm_add_sd(lo, _mm_unpackhi_pd(lo, lo)));
+}
+
+} // namespace
+
+double sum(const double* values, size_t n) {
+    __m256d acc = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm256_add_pd(acc, _mm256_loadu_pd(values + i));
+    }
+    double total = reduce_add(acc);
+    for (; i < n; ++i) total += values[i];
+    return total;
+}
+
+double dot(const double* a, const double* b, size_t n) {
+    __m256d acc = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+#if defined(__FMA__)
+        acc = _mm256_fmadd_pd(_mm256_loadu_pd(a + i),
+                              _mm256_loadu_pd(b + i), acc);
+#else
+        acc = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_loadu_pd(a + i),
+                                               _mm256_loadu_pd(b + i)));
+#endif
+    }
+    double total = reduce_add(acc);
+    for (; i < n; ++i) total += a[i] * b[i];
+    return total;
+}
+
+#else // scalar fallback (auto-vectorizable under the SSE flags)
+
+double sum(const double* values, size_t n) {
+    double total = 0.0;
+    for (size_t i = 0; i < n; ++i) total += values[i];
+    return total;
+}
+
+double dot(const double* a, const double* b, size_t n) {
+    double total = 0.0;
+    for (size_t i = 0; i < n; ++i) total += a[i] * b[i];
+    return total;
+}
+
+#endif
+
+double vwap(const double* prices, const double* volumes, size_t n) {
+    const double volume_sum = sum(volumes, n);
+    if (volume_sum < 1e-9) return 0.0;
+    return dot(prices, volumes, n) / volume_sum;
+}
+
+double weighted_imbalance(const double* bid_volumes, size_t bid_n,
+                          const double* ask_volumes, size_t ask_n) {
+    const double bid_sum = sum(bid_volumes, bid_n);
+    const double ask_sum = sum(ask_volumes, ask_n);
+    const double total = bid_sum + ask_sum;
+    if (total < 1e-9) return 0.0;
+    return (bid_sum - ask_sum) / total;
+}
+
+} // namespace features
+
+} // namespace quantumflow
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace quantumflow {
+
+struct PriceLevel;
+
+/// Structure-of-arrays mirror of one snapshot side: contiguous doubles that
+/// the vectorized feature kernels can stream through, instead of striding
+/// over the AoS PriceLevel layout (price/quantity/order_count interleaved).
+struct BookSideSoA {
+    std::vector<double> prices;
+    std::vector<double> volumes;
+
+    void assign(const std::vector<PriceLevel>& side);
+
+    size_t size() const { return prices.size(); }
+    bool empty() const { return prices.empty(); }
+};
+
+/// Vectorized feature kernels over contiguous double arrays. Implementations
+/// live in book_features.cpp, which the build compiles with the SIMD flags
+/// detected in CMakeLists.txt (AVX-512 / AVX2 / SSE, scalar otherwise).
+namespace features {
+
+/// Sum of the first n values.
+double sum(const double* values, size_t n);
+
+/// Inner product of the first n elements of a and b.
+double dot(const double* a, const double* b, size_t n);
+
+/// Volume-weighted average price over the first n levels; 0 when the
+/// volume sum is 0.
+double vwap(const double* prices, const double* volumes, size_t n);
+
+/// Volume-weighted book imbalance in [-1, 1]:
+/// (bid_sum - ask_sum) / (bid_sum + ask_sum), 0 when both sides are empty.
+double weighted_imbalance(const double* bid_volumes, size_t bid_n,
+                          const double* ask_volumes, size_t ask_n);
+
+} // namespace features
+
+} // namespace quantumflow
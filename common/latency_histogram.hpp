@@ -0,0 +1,179 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+namespace quantumflow {
+
+/// Per-stage percentile stats over one observation window, in microseconds.
+struct LatencyStageStats {
+    double p50_us = 0.0;
+    double p99_us = 0.0;
+    double p999_us = 0.0;
+    double max_us = 0.0;
+    uint64_t count = 0;
+};
+
+/// Hot-path latency histogram: fixed log2-bucketed bins with lock-free
+/// striped counters. record_ns is a single relaxed fetch_add on the
+/// caller's stripe; stripes are merged when stats() is read, so writers
+/// never contend with the reader. One bucket per bit width covers
+/// 1 ns .. ~18 s with at most 2x relative error.
+class LatencyHistogram {
+public:
+    static constexpr size_t NUM_BUCKETS = 64;
+    static constexpr size_t NUM_STRIPES = 8;
+
+    void record_ns(uint64_t ns) {
+        Stripe& stripe = stripes_[stripe_index()];
+        stripe.buckets[bucket_for(ns)].fetch_add(1, std::memory_order_relaxed);
+
+        uint64_t seen = stripe.max_ns.load(std::memory_order_relaxed);
+        while (ns > seen &&
+               !stripe.max_ns.compare_exchange_weak(seen, ns,
+                                                    std::memory_order_relaxed)) {
+        }
+    }
+
+    void record_us(double us) {
+        if (us <= 0.0) {
+            record_ns(0);
+            return;
+        }
+        record_ns(static_cast<uint64_t>(us * 1000.0));
+    }
+
+    /// Merge all stripes into percentile stats. Percentiles report the
+    /// upper bound of the bucket holding the rank, i.e. a conservative
+    /// estimate within the bucket's 2x resolution.
+    LatencyStageStats stats() const {
+        std::array<uint64_t, NUM_BUCKETS> merged{};
+        uint64_t total = 0;
+        uint64_t max_ns = 0;
+        for (const Stripe& stripe : stripes_) {
+            for (size_t b = 0; b < NUM_BUCKETS; ++b) {
+                uint64_t n = stripe.buckets[b].load(std::memory_order_relaxed);
+                merged[b] += n;
+                total += n;
+            }
+            uint64_t m = stripe.max_ns.load(std::memory_order_relaxed);
+            if (m > max_ns) max_ns = m;
+        }
+
+        LatencyStageStats out;
+        out.count = total;
+        out.max_us = static_cast<double>(max_ns) / 1000.0;
+        if (total == 0) {
+            return out;
+        }
+        out.p50_us = percentile_us(merged, total, 0.50);
+        out.p99_us = percentile_us(merged, total, 0.99);
+        out.p999_us = percentile_us(merged, total, 0.999);
+        return out;
+    }
+
+    /// Zero all counters; racing record_ns calls land in the new window.
+    void reset() {
+        for (Stripe& stripe : stripes_) {
+            for (auto& bucket : stripe.buckets) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+            stripe.max_ns.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    struct alignas(64) Stripe {
+        std::array<std::atomic<uint64_t>, NUM_BUCKETS> buckets{};
+        std::atomic<uint64_t> max_ns{0};
+    };
+
+    static size_t bucket_for(uint64_t ns) {
+        if (ns == 0) return 0;
+        return static_cast<size_t>(64 - __builtin_clzll(ns)) - 1;
+    }
+
+    static uint64_t bucket_upper_ns(size_t bucket) {
+        return bucket >= 63 ? UINT64_MAX : ((uint64_t{2} << bucket) - 1);
+    }
+
+    static size_t stripe_index() {
+        return std::hash<std::thread::id>{}(std::this_thread::get_id()) %
+               NUM_STRIPES;
+    }
+
+    static double percentile_us(const std::array<uint64_t, NUM_BUCKETS>& merged,
+                                uint64_t total, double q) {
+        const uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(total));
+        uint64_t seen = 0;
+        for (size_t b = 0; b < NUM_BUCKETS; ++b) {
+            seen += merged[b];
+            if (seen > rank) {
+                return static_cast<double>(bucket_upper_ns(b)) / 1000.0;
+            }
+        }
+        return static_cast<double>(bucket_upper_ns(NUM_BUCKETS - 1)) / 1000.0;
+    }
+
+    std::array<Stripe, NUM_STRIPES> stripes_{};
+};
+
+/// Histograms for every pipeline stage carried by LatencySnapshot, plus
+/// the merged window stats handed to the serializer.
+///
+/// The send_to_kernel / kernel_to_drain / drain_to_match stages come from
+/// the sampled per-packet stage trace (1-in-N packets on the UDS ingress,
+/// kernel receive stamp via SO_TIMESTAMPNS), splitting the coarse
+/// python_to_cpp number into the hop that actually moved.
+struct LatencyStats {
+    LatencyStageStats python_to_cpp;
+    LatencyStageStats send_to_kernel;
+    LatencyStageStats kernel_to_drain;
+    LatencyStageStats drain_to_match;
+    LatencyStageStats order_match;
+    LatencyStageStats strategy_eval;
+    LatencyStageStats ws_broadcast;
+    LatencyStageStats total;
+};
+
+class LatencyHistogramSet {
+public:
+    LatencyHistogram python_to_cpp;
+    LatencyHistogram send_to_kernel;
+    LatencyHistogram kernel_to_drain;
+    LatencyHistogram drain_to_match;
+    LatencyHistogram order_match;
+    LatencyHistogram strategy_eval;
+    LatencyHistogram ws_broadcast;
+    LatencyHistogram total;
+
+    LatencyStats stats() const {
+        LatencyStats out;
+        out.python_to_cpp = python_to_cpp.stats();
+        out.send_to_kernel = send_to_kernel.stats();
+        out.kernel_to_drain = kernel_to_drain.stats();
+        out.drain_to_match = drain_to_match.stats();
+        out.order_match = order_match.stats();
+        out.strategy_eval = strategy_eval.stats();
+        out.ws_broadcast = ws_broadcast.stats();
+        out.total = total.stats();
+        return out;
+    }
+
+    void reset() {
+        python_to_cpp.reset();
+        send_to_kernel.reset();
+        kernel_to_drain.reset();
+        drain_to_match.reset();
+        order_match.reset();
+        strategy_eval.reset();
+        ws_broadcast.reset();
+        total.reset();
+    }
+};
+
+} // namespace quantumflow
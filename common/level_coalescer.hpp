@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "common/symbol_table.hpp"
+
+namespace quantumflow {
+
+/// Frame-scoped staging table folding same-price L2 updates before they
+/// reach the book.
+///
+/// During depth bursts the feed sends many EVENT_BOOK_LEVEL packets for
+/// the same (symbol, side, price) within one drain frame; only the last
+/// quantity matters, yet each one would take the full set_level path.
+/// stage() records the latest quantity per key in a small open-addressed
+/// table (linear probing, power-of-two slots, insertion order preserved
+/// for the flush walk); duplicates overwrite in place and bump the
+/// coalesced counter. flush() applies the survivors and empties the table,
+/// so entries never outlive a frame.
+class LevelCoalescer {
+public:
+    static constexpr size_t SLOT_COUNT = 2048; // power of two
+
+    /// Stage one level update. Returns false when the table is full, in
+    /// which case the caller flushes and restages.
+    bool stage(SymbolId symbol, uint8_t side, uint64_t price, uint64_t quantity) {
+        const uint64_t key = make_key(symbol, side, price);
+        size_t idx = hash_key(key) & (SLOT_COUNT - 1);
+        for (size_t probe = 0; probe < SLOT_COUNT; ++probe) {
+            Slot& slot = slots_[idx];
+            if (!slot.used) {
+                if (staged_count_ == SLOT_COUNT) return false;
+                slot.used = true;
+                slot.key = key;
+                slot.quantity = quantity;
+                order_[staged_count_++] = static_cast<uint32_t>(idx);
+                return true;
+            }
+            if (slot.key == key) {
+                slot.quantity = quantity; // newer value wins
+                ++coalesced_count_;
+                return true;
+            }
+            idx = (idx + 1) & (SLOT_COUNT - 1);
+        }
+        return false;
+    }
+
+    /// Apply every surviving update in first-staged order and clear the
+    /// table. apply(symbol, side, price, quantity) runs once per key.
+    template <typename Apply>
+    void flush(Apply&& apply) {
+        for (size_t i = 0; i < staged_count_; ++i) {
+            Slot& slot = slots_[order_[i]];
+            apply(key_symbol(slot.key), key_side(slot.key), key_price(slot.key),
+                  slot.quantity);
+            slot.used = false;
+        }
+        staged_count_ = 0;
+    }
+
+    size_t staged() const { return staged_count_; }
+    bool empty() const { return staged_count_ == 0; }
+
+    /// Cumulative count of packets folded away (duplicates overwritten).
+    uint64_t coalesced_count() const { return coalesced_count_; }
+
+private:
+    // Key layout: price in the low 40 bits, side in bit 40, symbol above.
+    // Wire prices are pre-scaled ticks and fit comfortably in 40 bits; a
+    // price outside that range would alias, so keep the masks in sync with
+    // the wire protocol if scales ever grow.
+    static constexpr uint64_t PRICE_BITS = 40;
+    static constexpr uint64_t PRICE_MASK = (uint64_t{1} << PRICE_BITS) - 1;
+
+    static uint64_t make_key(SymbolId symbol, uint8_t side, uint64_t price) {
+        return (static_cast<uint64_t>(symbol) << (PRICE_BITS + 1)) |
+               (static_cast<uint64_t>(side & 1) << PRICE_BITS) |
+               (price & PRICE_MASK);
+    }
+
+    static SymbolId key_symbol(uint64_t key) {
+        return static_cast<SymbolId>(key >> (PRICE_BITS + 1));
+    }
+    static uint8_t key_side(uint64_t key) {
+        return static_cast<uint8_t>((key >> PRICE_BITS) & 1);
+    }
+    static uint64_t key_price(uint64_t key) { return key & PRICE_MASK; }
+
+    static uint64_t hash_key(uint64_t key) {
+        // Fibonacci hashing, as in FlatHashMap: the high bits carry the
+        // mixing, so shift them down before masking to the slot range.
+        return (key * 0x9E3779B97F4A7C15ULL) >> 32;
+    }
+
+    struct Slot {
+        uint64_t key = 0;
+        uint64_t quantity = 0;
+        bool used = false;
+    };
+
+    std::array<Slot, SLOT_COUNT> slots_{};
+    std::array<uint32_t, SLOT_COUNT> order_{};
+    size_t staged_count_ = 0;
+    uint64_t coalesced_count_ = 0;
+};
+
+} // namespace quantumflow
@@ -4,11 +4,28 @@
 
 namespace quantumflow {
 
+// event_type values (mirrored by QF_EVENT_* in the bridge C extension)
+inline constexpr uint8_t EVENT_BOOK_LEVEL = 0;   // L2 depth: set level to quantity
+inline constexpr uint8_t EVENT_TRADE = 1;        // executed trade
+inline constexpr uint8_t EVENT_ORDER_ADD = 2;    // L3: new order, keyed by order_id
+inline constexpr uint8_t EVENT_ORDER_CANCEL = 3; // L3: remove order_id
+inline constexpr uint8_t EVENT_ORDER_MODIFY = 4; // L3: amend order_id volume to quantity
+inline constexpr uint8_t EVENT_SYMBOL_CONFIG = 5; // session start: price carries the
+                                                  // price scale, quantity the qty scale
+inline constexpr uint8_t EVENT_BOOK_CHECKSUM = 6; // feed integrity: price carries the
+                                                  // canonical top-N checksum (see
+                                                  // LOB/Checksum.h), quantity the depth
+
+// Integer wire protocol: the sender scales prices to integer ticks once
+// (scale announced per symbol via EVENT_SYMBOL_CONFIG at session start and
+// recorded in PriceConverterRegistry), so the per-packet hot path on the
+// receiving side is pure integer moves. Doubles reappear only at the
+// consumption edges (TradeInfo for strategies, WebUI serialization).
 struct MarketDataPacket {
     char symbol[16];
     uint8_t side;        // 0 = buy, 1 = sell
-    uint8_t event_type;  // 0 = book_level, 1 = trade
-    double price;
+    uint8_t event_type;  // see EVENT_* above
+    uint64_t price;      // pre-scaled integer ticks (price scale per symbol)
     uint64_t quantity;
     uint64_t timestamp_ns;
     uint64_t order_id;
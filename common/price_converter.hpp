@@ -4,7 +4,9 @@
 #include <cmath>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include "LOB/Types.h"
+#include "common/symbol_table.hpp"
 
 namespace quantumflow {
 
@@ -51,10 +53,28 @@ public:
         return default_;
     }
 
+    /// SymbolId-indexed fast path: flat array lookup, no string hashing.
+    /// Unset ids fall back to the default converter.
+    void set_scale(SymbolId id, double scale) {
+        if (id == INVALID_SYMBOL_ID) return;
+        if (id >= by_id_.size()) {
+            by_id_.resize(id + 1, default_);
+        }
+        by_id_[id] = PriceConverter(scale);
+    }
+
+    const PriceConverter& get(SymbolId id) const {
+        if (id < by_id_.size()) {
+            return by_id_[id];
+        }
+        return default_;
+    }
+
 private:
     double default_scale_;
     PriceConverter default_{100.0};
     std::unordered_map<std::string, PriceConverter> converters_;
+    std::vector<PriceConverter> by_id_;
 };
 
 } // namespace quantumflow
@@ -0,0 +1,134 @@
+#include "common/rolling_stats.hpp"
+
+#include <algorithm>
+
+namespace quantumflow {
+
+RollingWindowStats RollingWindowStats::by_time(uint64_t window_ns) {
+    return RollingWindowStats(std::max<uint64_t>(1, window_ns), 0);
+}
+
+RollingWindowStats RollingWindowStats::by_count(size_t max_trades) {
+    return RollingWindowStats(0, std::max<size_t>(1, max_trades));
+}
+
+void RollingWindowStats::add(const TradeInfo& trade) {
+    entries_.push_back(trade);
+    volume_ += trade.quantity;
+    notional_ += trade.price * static_cast<double>(trade.quantity);
+    price_sum_ += trade.price;
+    price_sq_sum_ += trade.price * trade.price;
+
+    // Keep the runs monotonic; equal prices stay so eviction can match them.
+    while (!max_run_.empty() && max_run_.back() < trade.price) max_run_.pop_back();
+    max_run_.push_back(trade.price);
+    while (!min_run_.empty() && min_run_.back() > trade.price) min_run_.pop_back();
+    min_run_.push_back(trade.price);
+
+    if (is_time_window()) {
+        advance(trade.timestamp_ns);
+    } else {
+        while (entries_.size() > max_trades_) evict_front();
+    }
+}
+
+void RollingWindowStats::advance(uint64_t now_ns) {
+    if (!is_time_window()) return;
+    while (!entries_.empty() &&
+           entries_.front().timestamp_ns + window_ns_ <= now_ns) {
+        evict_front();
+    }
+}
+
+void RollingWindowStats::evict_front() {
+    const TradeInfo& trade = entries_.front();
+    volume_ -= trade.quantity;
+    notional_ -= trade.price * static_cast<double>(trade.quantity);
+    price_sum_ -= trade.price;
+    price_sq_sum_ -= trade.price * trade.price;
+    if (!max_run_.empty() && max_run_.front() == trade.price) max_run_.pop_front();
+    if (!min_run_.empty() && min_run_.front() == trade.price) min_run_.pop_front();
+    entries_.pop_front();
+    if (entries_.empty()) {
+        // Re-zero the running sums so floating-point residue cannot pile up
+        // across many fill/drain cycles.
+        volume_ = 0;
+        notional_ = 0.0;
+        price_sum_ = 0.0;
+        price_sq_sum_ = 0.0;
+    }
+}
+
+double RollingWindowStats::vwap() const {
+    if (volume_ == 0) return 0.0;
+    return notional_ / static_cast<double>(volume_);
+}
+
+double RollingWindowStats::mean_price() const {
+    if (entries_.empty()) return 0.0;
+    return price_sum_ / static_cast<double>(entries_.size());
+}
+
+double RollingWindowStats::variance() const {
+    if (entries_.empty()) return 0.0;
+    const double mean = mean_price();
+    const double raw =
+        price_sq_sum_ / static_cast<double>(entries_.size()) - mean * mean;
+    return std::max(0.0, raw);
+}
+
+double RollingWindowStats::max_price() const {
+    return max_run_.empty() ? 0.0 : max_run_.front();
+}
+
+double RollingWindowStats::min_price() const {
+    return min_run_.empty() ? 0.0 : min_run_.front();
+}
+
+void RollingWindowStats::reset() {
+    entries_.clear();
+    max_run_.clear();
+    min_run_.clear();
+    volume_ = 0;
+    notional_ = 0.0;
+    price_sum_ = 0.0;
+    price_sq_sum_ = 0.0;
+}
+
+RollingTradeStats::WindowId RollingTradeStats::time_window(uint64_t window_ns) {
+    window_ns = std::max<uint64_t>(1, window_ns);
+    for (WindowId id = 0; id < windows_.size(); ++id) {
+        if (windows_[id].is_time_window() &&
+            windows_[id].window_ns() == window_ns) {
+            return id;
+        }
+    }
+    windows_.push_back(RollingWindowStats::by_time(window_ns));
+    return windows_.size() - 1;
+}
+
+RollingTradeStats::WindowId RollingTradeStats::count_window(size_t max_trades) {
+    max_trades = std::max<size_t>(1, max_trades);
+    for (WindowId id = 0; id < windows_.size(); ++id) {
+        if (!windows_[id].is_time_window() &&
+            windows_[id].max_trades() == max_trades) {
+            return id;
+        }
+    }
+    windows_.push_back(RollingWindowStats::by_count(max_trades));
+    return windows_.size() - 1;
+}
+
+void RollingTradeStats::on_trade(const TradeInfo& trade) {
+    for (auto& window : windows_) window.add(trade);
+}
+
+void RollingTradeStats::advance(uint64_t now_ns) {
+    for (auto& window : windows_) window.advance(now_ns);
+}
+
+void RollingTradeStats::reset() {
+    for (auto& window : windows_) window.reset();
+}
+
+} // namespace quantumflow
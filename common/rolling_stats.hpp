@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "common/trade_ring.hpp"
+
+namespace quantumflow {
+
+/// One rolling window of trade statistics, either time-based (all trades
+/// newer than now - window_ns) or count-based (the last max_trades trades).
+/// Every aggregate is maintained incrementally: add() and the eviction paths
+/// are amortized O(1) per trade (max/min use the classic monotonic-deque
+/// sliding-window scheme), so reads are plain field lookups instead of the
+/// O(window) re-scans the strategies used to do per tick.
+class RollingWindowStats {
+public:
+    static RollingWindowStats by_time(uint64_t window_ns);
+    static RollingWindowStats by_count(size_t max_trades);
+
+    /// Fold one trade into the window, evicting whatever it pushes out.
+    /// Trades must arrive in non-decreasing timestamp order.
+    void add(const TradeInfo& trade);
+
+    /// Evict entries that have aged out of a time window as of now_ns.
+    /// No-op for count windows.
+    void advance(uint64_t now_ns);
+
+    size_t count() const { return entries_.size(); }
+    uint64_t volume() const { return volume_; }
+    /// Sum of price * quantity over the window.
+    double notional() const { return notional_; }
+    double vwap() const;
+    double mean_price() const;
+    /// Population variance of trade prices over the window.
+    double variance() const;
+    double max_price() const;
+    double min_price() const;
+
+    void reset();
+
+    bool is_time_window() const { return window_ns_ != 0; }
+    uint64_t window_ns() const { return window_ns_; }
+    size_t max_trades() const { return max_trades_; }
+
+private:
+    RollingWindowStats(uint64_t window_ns, size_t max_trades)
+        : window_ns_(window_ns), max_trades_(max_trades) {}
+
+    void evict_front();
+
+    uint64_t window_ns_;  // 0 for count windows
+    size_t max_trades_;   // 0 for time windows
+
+    std::deque<TradeInfo> entries_;
+    uint64_t volume_ = 0;
+    double notional_ = 0.0;
+    double price_sum_ = 0.0;
+    double price_sq_sum_ = 0.0;
+    // Monotonic deques over entry prices: fronts are the current max/min.
+    std::deque<double> max_run_;
+    std::deque<double> min_run_;
+};
+
+/// Shared rolling-statistics service owned by a strategy engine. Strategies
+/// declare the windows they need once, at registration time, through
+/// Strategy::declare_windows(); identical declarations are deduplicated so
+/// strategies asking for the same window share one set of aggregates. The
+/// engine feeds every trade through on_trade() and ticks time windows with
+/// advance() before each evaluation pass.
+class RollingTradeStats {
+public:
+    using WindowId = size_t;
+
+    /// Declare (or find) a time window covering the last window_ns.
+    WindowId time_window(uint64_t window_ns);
+
+    /// Declare (or find) a count window covering the last max_trades trades.
+    WindowId count_window(size_t max_trades);
+
+    void on_trade(const TradeInfo& trade);
+    void advance(uint64_t now_ns);
+
+    const RollingWindowStats& window(WindowId id) const { return windows_[id]; }
+    size_t window_count() const { return windows_.size(); }
+
+    void reset();
+
+private:
+    std::vector<RollingWindowStats> windows_;
+};
+
+} // namespace quantumflow
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "common/signal_types.hpp"
+
+namespace quantumflow {
+
+/// One recorded signal transition. Confidence is bucketed into tenths so
+/// jitter inside a bucket does not churn the history; the exact value at
+/// the moment of the transition is kept alongside for analysis.
+struct SignalTransition {
+    uint64_t timestamp_ns;
+    double confidence;
+    Signal signal;
+    uint8_t confidence_bucket; // floor(confidence * 10), capped at 9
+};
+
+/// Fixed-capacity per-strategy transition history. record() is called on
+/// every evaluation but appends only when the signal or the confidence
+/// bucket changed since the last recorded entry, so a strategy sitting on
+/// NEUTRAL costs one branch per tick and the ring holds genuine
+/// transitions spanning minutes, not the last few seconds of ticks. Once
+/// full the oldest transition is overwritten (same policy as TradeRing).
+class SignalHistoryRing {
+public:
+    static constexpr size_t CAPACITY = 512;
+
+    static uint8_t bucket_for(double confidence) {
+        if (confidence <= 0.0) return 0;
+        const int b = static_cast<int>(confidence * 10.0);
+        return static_cast<uint8_t>(b > 9 ? 9 : b);
+    }
+
+    /// Record an evaluation result; returns true when it appended a
+    /// transition (signal or confidence bucket moved).
+    bool record(Signal signal, double confidence, uint64_t timestamp_ns) {
+        const uint8_t bucket = bucket_for(confidence);
+        if (count_ > 0) {
+            const SignalTransition& last =
+                buffer_[(head_ + count_ - 1) % CAPACITY];
+            if (last.signal == signal && last.confidence_bucket == bucket) {
+                return false;
+            }
+        }
+        buffer_[(head_ + count_) % CAPACITY] =
+            SignalTransition{timestamp_ns, confidence, signal, bucket};
+        if (count_ < CAPACITY) {
+            ++count_;
+        } else {
+            head_ = (head_ + 1) % CAPACITY;
+        }
+        ++transitions_;
+        return true;
+    }
+
+    void clear() {
+        head_ = 0;
+        count_ = 0;
+    }
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    /// Oldest-first access to the retained transitions.
+    const SignalTransition& operator[](size_t i) const {
+        return buffer_[(head_ + i) % CAPACITY];
+    }
+
+    /// Lifetime transition count, including entries the ring has since
+    /// overwritten; the gap to size() is how much history was lost.
+    uint64_t transitions() const { return transitions_; }
+
+    /// Binary export for post-trade analysis tooling: "QFSH" magic,
+    /// uint16 version, uint16 record count, then per transition (oldest
+    /// first, packed little-endian):
+    ///   uint64 timestamp_ns, double confidence, uint8 signal,
+    ///   uint8 confidence_bucket
+    /// Appends to out and returns the number of records written.
+    size_t export_binary(std::string& out) const {
+        const uint16_t version = 1;
+        const uint16_t n = static_cast<uint16_t>(count_);
+        out.append("QFSH", 4);
+        append_raw(out, version);
+        append_raw(out, n);
+        for (size_t i = 0; i < count_; ++i) {
+            const SignalTransition& t = (*this)[i];
+            append_raw(out, t.timestamp_ns);
+            append_raw(out, t.confidence);
+            append_raw(out, static_cast<uint8_t>(t.signal));
+            append_raw(out, t.confidence_bucket);
+        }
+        return count_;
+    }
+
+private:
+    template <typename T>
+    static void append_raw(std::string& out, const T& value) {
+        const char* p = reinterpret_cast<const char*>(&value);
+        out.append(p, sizeof(T));
+    }
+
+    std::array<SignalTransition, CAPACITY> buffer_{};
+    size_t head_ = 0;
+    size_t count_ = 0;
+    uint64_t transitions_ = 0;
+};
+
+} // namespace quantumflow
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace quantumflow {
+
+/// Dense integer id for an interned symbol. Ids start at 0 and are stable
+/// for the lifetime of the table, so they can index flat per-symbol arrays.
+using SymbolId = uint32_t;
+
+inline constexpr SymbolId INVALID_SYMBOL_ID = 0xFFFFFFFFu;
+inline constexpr size_t SYMBOL_RAW_LEN = 16; // matches MarketDataPacket::symbol
+
+/// Interns fixed 16-byte packet symbols to dense SymbolIds.
+/// The hot-path lookup hashes the raw bytes as two uint64 words — no
+/// std::string construction and no heap allocation once a symbol is known.
+/// Open addressing with linear probing, mirroring FlatHashMap's approach.
+class SymbolTable {
+public:
+    SymbolTable()
+        : slots_(INITIAL_CAPACITY) {}
+
+    /// Intern a raw 16-byte, NUL-padded symbol (e.g. MarketDataPacket::symbol).
+    /// Returns INVALID_SYMBOL_ID for an all-zero (empty) symbol.
+    SymbolId intern(const char (&raw)[SYMBOL_RAW_LEN]) {
+        uint64_t lo, hi;
+        load_words(raw, lo, hi);
+        if (lo == 0 && hi == 0) {
+            return INVALID_SYMBOL_ID;
+        }
+
+        size_t mask = slots_.size() - 1;
+        size_t idx = static_cast<size_t>(mix(lo, hi)) & mask;
+        while (true) {
+            Slot& slot = slots_[idx];
+            if (slot.id == INVALID_SYMBOL_ID) {
+                break; // not present; insert below
+            }
+            if (slot.lo == lo && slot.hi == hi) {
+                return slot.id;
+            }
+            idx = (idx + 1) & mask;
+        }
+
+        if ((names_.size() + 1) * 10 > slots_.size() * 7) {
+            grow();
+            mask = slots_.size() - 1;
+            idx = static_cast<size_t>(mix(lo, hi)) & mask;
+            while (slots_[idx].id != INVALID_SYMBOL_ID) {
+                idx = (idx + 1) & mask;
+            }
+        }
+
+        SymbolId id = static_cast<SymbolId>(names_.size());
+        names_.emplace_back(raw, ::strnlen(raw, SYMBOL_RAW_LEN));
+        slots_[idx] = Slot{lo, hi, id};
+        return id;
+    }
+
+    /// Intern by name (config path, not hot). Truncates to 15 characters to
+    /// match the wire format's NUL-terminated 16-byte field.
+    SymbolId intern(std::string_view name) {
+        char raw[SYMBOL_RAW_LEN]{};
+        size_t n = name.size() < SYMBOL_RAW_LEN - 1 ? name.size() : SYMBOL_RAW_LEN - 1;
+        std::memcpy(raw, name.data(), n);
+        return intern(raw);
+    }
+
+    /// Lookup without inserting. Returns INVALID_SYMBOL_ID if unknown.
+    SymbolId find(const char (&raw)[SYMBOL_RAW_LEN]) const {
+        uint64_t lo, hi;
+        load_words(raw, lo, hi);
+        if (lo == 0 && hi == 0) {
+            return INVALID_SYMBOL_ID;
+        }
+        size_t mask = slots_.size() - 1;
+        size_t idx = static_cast<size_t>(mix(lo, hi)) & mask;
+        while (true) {
+            const Slot& slot = slots_[idx];
+            if (slot.id == INVALID_SYMBOL_ID) {
+                return INVALID_SYMBOL_ID;
+            }
+            if (slot.lo == lo && slot.hi == hi) {
+                return slot.id;
+            }
+            idx = (idx + 1) & mask;
+        }
+    }
+
+    const std::string& name(SymbolId id) const { return names_[id]; }
+    size_t size() const { return names_.size(); }
+
+    /// Stateless hash of a raw 16-byte symbol, usable for shard routing
+    /// without touching the table.
+    static uint64_t hash_raw(const char (&raw)[SYMBOL_RAW_LEN]) {
+        uint64_t lo, hi;
+        load_words(raw, lo, hi);
+        return mix(lo, hi);
+    }
+
+private:
+    struct Slot {
+        uint64_t lo = 0;
+        uint64_t hi = 0;
+        SymbolId id = INVALID_SYMBOL_ID;
+    };
+
+    static constexpr size_t INITIAL_CAPACITY = 256; // power of two
+
+    static void load_words(const char* raw, uint64_t& lo, uint64_t& hi) {
+        std::memcpy(&lo, raw, sizeof(lo));
+        std::memcpy(&hi, raw + sizeof(lo), sizeof(hi));
+    }
+
+    // Fibonacci-style mix of the two symbol words (cf. FlatHashMap::fib_hash).
+    static uint64_t mix(uint64_t lo, uint64_t hi) {
+        return (lo ^ (hi * UINT64_C(0x9E3779B97F4A7C15))) *
+               UINT64_C(11400714819323198485);
+    }
+
+    void grow() {
+        std::vector<Slot> old = std::move(slots_);
+        slots_.assign(old.size() * 2, Slot{});
+        size_t mask = slots_.size() - 1;
+        for (const Slot& slot : old) {
+            if (slot.id == INVALID_SYMBOL_ID) continue;
+            size_t idx = static_cast<size_t>(mix(slot.lo, slot.hi)) & mask;
+            while (slots_[idx].id != INVALID_SYMBOL_ID) {
+                idx = (idx + 1) & mask;
+            }
+            slots_[idx] = slot;
+        }
+    }
+
+    std::vector<Slot> slots_;
+    std::vector<std::string> names_;
+};
+
+} // namespace quantumflow
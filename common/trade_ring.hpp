@@ -0,0 +1,117 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <cstdint>
+#include <vector>
+
+namespace quantumflow {
+
+struct TradeInfo {
+    double price;
+    uint64_t quantity;
+    uint8_t side;
+    uint64_t timestamp_ns;
+};
+
+/// Non-owning view over trade history, oldest first. Covers at most two
+/// contiguous segments so a wrapped TradeRing can be iterated without
+/// copying; a plain std::vector converts implicitly as a single segment.
+class TradeView {
+public:
+    class iterator {
+    public:
+        using value_type = TradeInfo;
+        using reference = const TradeInfo&;
+        using pointer = const TradeInfo*;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        iterator(const TradeView* view, size_t index)
+            : view_(view), index_(index) {}
+
+        reference operator*() const { return (*view_)[index_]; }
+        pointer operator->() const { return &(*view_)[index_]; }
+        iterator& operator++() { ++index_; return *this; }
+        bool operator==(const iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const iterator& other) const { return index_ != other.index_; }
+
+    private:
+        const TradeView* view_;
+        size_t index_;
+    };
+
+    TradeView() = default;
+
+    TradeView(const TradeInfo* data, size_t count)
+        : seg0_(data), n0_(count) {}
+
+    TradeView(const std::vector<TradeInfo>& trades)
+        : seg0_(trades.data()), n0_(trades.size()) {}
+
+    TradeView(const TradeInfo* seg0, size_t n0, const TradeInfo* seg1, size_t n1)
+        : seg0_(seg0), n0_(n0), seg1_(seg1), n1_(n1) {}
+
+    size_t size() const { return n0_ + n1_; }
+    bool empty() const { return n0_ == 0 && n1_ == 0; }
+
+    const TradeInfo& operator[](size_t i) const {
+        return i < n0_ ? seg0_[i] : seg1_[i - n0_];
+    }
+
+    const TradeInfo& front() const { return (*this)[0]; }
+    const TradeInfo& back() const { return (*this)[size() - 1]; }
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, size()); }
+
+private:
+    const TradeInfo* seg0_ = nullptr;
+    size_t n0_ = 0;
+    const TradeInfo* seg1_ = nullptr;
+    size_t n1_ = 0;
+};
+
+/// Fixed-capacity circular trade buffer. push() overwrites the oldest
+/// entry once full, so history maintenance is pure index arithmetic:
+/// no vector erase, no memmove, no allocation after construction.
+template <size_t Capacity>
+class TradeRing {
+    static_assert(Capacity > 0, "TradeRing capacity must be non-zero");
+
+public:
+    void push(const TradeInfo& trade) {
+        buffer_[(head_ + count_) % Capacity] = trade;
+        if (count_ < Capacity) {
+            ++count_;
+        } else {
+            head_ = (head_ + 1) % Capacity;
+        }
+    }
+
+    void clear() {
+        head_ = 0;
+        count_ = 0;
+    }
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+    static constexpr size_t capacity() { return Capacity; }
+
+    /// Oldest-first view over the current contents; valid until the next
+    /// push or clear.
+    TradeView view() const {
+        const size_t first_len = std::min(count_, Capacity - head_);
+        return TradeView(buffer_.data() + head_, first_len,
+                         buffer_.data(), count_ - first_len);
+    }
+
+private:
+    std::array<TradeInfo, Capacity> buffer_{};
+    size_t head_ = 0;
+    size_t count_ = 0;
+};
+
+} // namespace quantumflow
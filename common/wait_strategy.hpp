@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <ctime>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace quantumflow {
+
+/// One PAUSE-class hint to the core: cheap enough to sit in a spin loop,
+/// frees the sibling hyperthread's pipeline slots while we wait.
+inline void cpu_pause() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#endif
+}
+
+/// Pin the calling thread to one core (-1 = leave unpinned). Returns true
+/// when the affinity was applied; non-Linux platforms report false.
+inline bool pin_current_thread(int core) {
+#if defined(__linux__)
+    if (core < 0) return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(static_cast<unsigned>(core), &set);
+    return ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)core;
+    return false;
+#endif
+}
+
+/// Spin-then-yield-then-sleep consumer wait strategy.
+///
+/// Escalation ladder per quiet stretch: busy-spin with cpu_pause() for
+/// spin_limit iterations (sub-microsecond wakeup on the first packet after
+/// a lull), then sched_yield for yield_limit iterations, then nanosleep
+/// with the sleep doubling from 1 µs up to max_sleep_ns. reset() on any
+/// progress drops back to the spin phase, so a stream of packets never
+/// pays the sleep penalty that a fixed nanosleep imposes today.
+class WaitStrategy {
+public:
+    explicit WaitStrategy(uint32_t spin_limit = 4096,
+                          uint32_t yield_limit = 64,
+                          uint64_t max_sleep_ns = 100'000)
+        : spin_limit_(spin_limit),
+          yield_limit_(yield_limit),
+          max_sleep_ns_(max_sleep_ns),
+          idle_count_(0),
+          sleep_ns_(0) {}
+
+    /// Call once per unproductive poll; blocks (or not) per the ladder.
+    void idle() {
+        if (idle_count_ < spin_limit_) {
+            ++idle_count_;
+            cpu_pause();
+            return;
+        }
+        if (idle_count_ < spin_limit_ + yield_limit_) {
+            ++idle_count_;
+#if defined(__linux__)
+            ::sched_yield();
+#endif
+            return;
+        }
+        sleep_ns_ = (sleep_ns_ == 0) ? 1'000 : sleep_ns_ * 2;
+        if (sleep_ns_ > max_sleep_ns_) sleep_ns_ = max_sleep_ns_;
+        struct timespec ts = {0, static_cast<long>(sleep_ns_)};
+        ::nanosleep(&ts, nullptr);
+    }
+
+    /// Call after productive work; rewinds the ladder to the spin phase.
+    void reset() {
+        idle_count_ = 0;
+        sleep_ns_ = 0;
+    }
+
+    /// True while in the spin/yield phases (useful for gating idle work
+    /// that should only run once the consumer has genuinely gone quiet).
+    bool spinning() const { return idle_count_ < spin_limit_ + yield_limit_; }
+
+private:
+    uint32_t spin_limit_;
+    uint32_t yield_limit_;
+    uint64_t max_sleep_ns_;
+    uint32_t idle_count_;
+    uint64_t sleep_ns_;
+};
+
+} // namespace quantumflow
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
@@ -41,73 +42,164 @@ inline void alignedFree(void* ptr) {
 // ═══════════════════════════════════════════════
 // Lock-Free Free List (for ultra-fast allocation)
 // Uses compare-and-swap for thread-safe O(1) alloc/free
+// Grows by chaining slabs (CAS-guarded) up to a hard cap
 // ═══════════════════════════════════════════════
+
+// Runtime telemetry for LockFreePool, queryable via stats() so pools can
+// be right-sized from production numbers instead of guessed.
+struct LockFreePoolStats {
+    size_t capacity;            // blocks across all slabs
+    size_t inUse;               // currently allocated blocks
+    size_t highWater;           // lifetime peak of inUse
+    size_t slabCount;           // slabs in the chain
+    size_t growEvents;          // successful slab additions
+    size_t failedAllocations;   // allocate() calls that returned nullptr
+};
+
 template<typename T>
 class LockFreePool {
     static_assert(sizeof(T) >= sizeof(void*), "T must be at least pointer size");
-    
+
     struct Node {
         std::atomic<Node*> next;
     };
 
+    // One backing slab: header + cache-line aligned block storage in a
+    // single allocation, chained newest-first for the destructor walk.
+    struct Slab {
+        Slab* next;
+        size_t blocks;
+        // blocks start at the next 64-byte boundary after the header
+    };
+    static constexpr size_t SLAB_HEADER = (sizeof(Slab) + 63) & ~size_t(63);
+
     std::atomic<Node*> m_freeHead{nullptr};
+    std::atomic<Slab*> m_slabHead{nullptr};
     std::atomic<size_t> m_allocated{0};
     std::atomic<size_t> m_capacity{0};
-    
-    void* m_buffer{nullptr};
+    std::atomic<size_t> m_highWater{0};
+    std::atomic<size_t> m_growEvents{0};
+    std::atomic<size_t> m_failedAllocations{0};
+    std::atomic<bool> m_growing{false};
+
     size_t m_blockSize;
+    size_t m_slabBlocks;
     size_t m_maxBlocks;
 
+    static char* slabData(Slab* slab) {
+        return reinterpret_cast<char*>(slab) + SLAB_HEADER;
+    }
+
+    // Allocate a slab of `blocks`, link its nodes into a local chain and
+    // splice the chain onto the free list in one CAS loop. Returns false
+    // on OOM (constructor callers throw instead).
+    bool addSlab(size_t blocks) {
+        void* raw = alignedAlloc(SLAB_HEADER + blocks * m_blockSize, 64);
+        if (!raw) return false;
+        Slab* slab = static_cast<Slab*>(raw);
+        slab->blocks = blocks;
+
+        char* data = slabData(slab);
+        for (size_t i = 0; i + 1 < blocks; ++i) {
+            reinterpret_cast<Node*>(data + i * m_blockSize)->next.store(
+                reinterpret_cast<Node*>(data + (i + 1) * m_blockSize),
+                std::memory_order_relaxed);
+        }
+        Node* first = reinterpret_cast<Node*>(data);
+        Node* last = reinterpret_cast<Node*>(data + (blocks - 1) * m_blockSize);
+
+        Node* oldHead = m_freeHead.load(std::memory_order_acquire);
+        do {
+            last->next.store(oldHead, std::memory_order_relaxed);
+        } while (!m_freeHead.compare_exchange_weak(oldHead, first,
+                    std::memory_order_release, std::memory_order_acquire));
+
+        slab->next = m_slabHead.load(std::memory_order_relaxed);
+        m_slabHead.store(slab, std::memory_order_release);
+        m_capacity.fetch_add(blocks, std::memory_order_release);
+        return true;
+    }
+
+    // CAS-guarded grow path. Returns true when capacity increased (by
+    // this thread or a concurrent winner), false at the hard cap or OOM,
+    // so allocate() knows whether re-probing the free list is worthwhile.
+    bool grow() {
+        size_t capBefore = m_capacity.load(std::memory_order_acquire);
+        if (capBefore >= m_maxBlocks) return false;
+
+        bool expected = false;
+        if (!m_growing.compare_exchange_strong(expected, true,
+                std::memory_order_acquire, std::memory_order_relaxed)) {
+            // Another thread owns the grow; wait it out and report
+            // whether capacity actually moved.
+            while (m_growing.load(std::memory_order_acquire)) { }
+            return m_capacity.load(std::memory_order_acquire) > capBefore;
+        }
+
+        size_t cap = m_capacity.load(std::memory_order_relaxed);
+        size_t room = (cap < m_maxBlocks) ? m_maxBlocks - cap : 0;
+        bool grew = false;
+        if (room > 0) {
+            grew = addSlab(std::min(m_slabBlocks, room));
+            if (grew) m_growEvents.fetch_add(1, std::memory_order_relaxed);
+        }
+        m_growing.store(false, std::memory_order_release);
+        return grew;
+    }
+
 public:
-    explicit LockFreePool(size_t maxBlocks = 4096) 
+    // slabBlocks is the initial slab and the growth increment; maxBlocks
+    // is the hard cap across all slabs. maxBlocks == 0 keeps the old
+    // fixed-capacity behaviour (cap == slabBlocks, never grows).
+    explicit LockFreePool(size_t slabBlocks = 4096, size_t maxBlocks = 0)
         : m_blockSize(std::max(sizeof(T), sizeof(Node)))
-        , m_maxBlocks(maxBlocks)
+        , m_slabBlocks(slabBlocks)
+        , m_maxBlocks(maxBlocks ? maxBlocks : slabBlocks)
     {
-        // Allocate cache-line aligned buffer
-        size_t bufferSize = m_maxBlocks * m_blockSize;
-        m_buffer = alignedAlloc(bufferSize, 64);
-        if (!m_buffer) throw std::bad_alloc();
-        
-        m_capacity.store(m_maxBlocks, std::memory_order_release);
-        
-        // Pre-link all blocks into free list
-        for (size_t i = 0; i < m_maxBlocks; ++i) {
-            Node* node = reinterpret_cast<Node*>(
-                static_cast<char*>(m_buffer) + i * m_blockSize
-            );
-            Node* nextNode = (i + 1 < m_maxBlocks) 
-                ? reinterpret_cast<Node*>(static_cast<char*>(m_buffer) + (i + 1) * m_blockSize)
-                : nullptr;
-            node->next.store(nextNode, std::memory_order_relaxed);
-        }
-        m_freeHead.store(reinterpret_cast<Node*>(m_buffer), std::memory_order_release);
+        if (m_maxBlocks < m_slabBlocks) m_maxBlocks = m_slabBlocks;
+        if (!addSlab(m_slabBlocks)) throw std::bad_alloc();
     }
 
     ~LockFreePool() {
-        alignedFree(m_buffer);
+        Slab* slab = m_slabHead.load(std::memory_order_acquire);
+        while (slab) {
+            Slab* next = slab->next;
+            alignedFree(slab);
+            slab = next;
+        }
     }
 
     // Non-copyable, non-movable
     LockFreePool(const LockFreePool&) = delete;
     LockFreePool& operator=(const LockFreePool&) = delete;
 
-    // Lock-free allocation - O(1) amortized
+    // Lock-free allocation - O(1) amortized; on an empty free list the
+    // pool grows by one slab (up to maxBlocks) before giving up.
     T* allocate() {
-        Node* oldHead = m_freeHead.load(std::memory_order_acquire);
-        
-        while (oldHead) {
-            Node* nextNode = oldHead->next.load(std::memory_order_relaxed);
-            
-            if (m_freeHead.compare_exchange_weak(oldHead, nextNode,
-                    std::memory_order_release, std::memory_order_acquire)) {
-                m_allocated.fetch_add(1, std::memory_order_relaxed);
-                return reinterpret_cast<T*>(oldHead);
+        for (;;) {
+            Node* oldHead = m_freeHead.load(std::memory_order_acquire);
+
+            while (oldHead) {
+                Node* nextNode = oldHead->next.load(std::memory_order_relaxed);
+
+                if (m_freeHead.compare_exchange_weak(oldHead, nextNode,
+                        std::memory_order_release, std::memory_order_acquire)) {
+                    size_t used = m_allocated.fetch_add(1, std::memory_order_relaxed) + 1;
+                    size_t hw = m_highWater.load(std::memory_order_relaxed);
+                    while (used > hw &&
+                           !m_highWater.compare_exchange_weak(hw, used,
+                               std::memory_order_relaxed)) { }
+                    return reinterpret_cast<T*>(oldHead);
+                }
+                // CAS failed, oldHead updated by compare_exchange_weak, retry
+            }
+
+            if (!grow()) {
+                // At the hard cap (or OOM) with nothing on the free list
+                m_failedAllocations.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
             }
-            // CAS failed, oldHead updated by compare_exchange_weak, retry
         }
-        
-        // Pool exhausted
-        return nullptr;
     }
 
     // Lock-free deallocation - O(1)
@@ -143,6 +235,20 @@ public:
 
     size_t size() const { return m_allocated.load(std::memory_order_relaxed); }
     size_t capacity() const { return m_capacity.load(std::memory_order_relaxed); }
+
+    LockFreePoolStats stats() const {
+        LockFreePoolStats s{};
+        s.capacity = m_capacity.load(std::memory_order_relaxed);
+        s.inUse = m_allocated.load(std::memory_order_relaxed);
+        s.highWater = m_highWater.load(std::memory_order_relaxed);
+        s.growEvents = m_growEvents.load(std::memory_order_relaxed);
+        s.failedAllocations = m_failedAllocations.load(std::memory_order_relaxed);
+        for (Slab* slab = m_slabHead.load(std::memory_order_acquire); slab;
+             slab = slab->next) {
+            ++s.slabCount;
+        }
+        return s;
+    }
 };
 
 
@@ -397,6 +503,39 @@ public:
         return true;
     }
 
+    // Bulk variants: a single tail/head update covers the whole span, so
+    // producer and consumer exchange the index cache lines once per batch
+    // instead of once per item. Returns the number of items transferred.
+    size_t tryPushN(const T* items, size_t count) {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        size_t head = m_head.load(std::memory_order_acquire);
+        size_t free = (head - tail - 1) & (Capacity - 1);
+        size_t n = count < free ? count : free;
+        
+        for (size_t i = 0; i < n; ++i) {
+            m_buffer[(tail + i) & (Capacity - 1)] = items[i];
+        }
+        if (n > 0) {
+            m_tail.store((tail + n) & (Capacity - 1), std::memory_order_release);
+        }
+        return n;
+    }
+
+    size_t tryPopN(T* items, size_t count) {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        size_t tail = m_tail.load(std::memory_order_acquire);
+        size_t avail = (tail - head) & (Capacity - 1);
+        size_t n = count < avail ? count : avail;
+        
+        for (size_t i = 0; i < n; ++i) {
+            items[i] = m_buffer[(head + i) & (Capacity - 1)];
+        }
+        if (n > 0) {
+            m_head.store((head + n) & (Capacity - 1), std::memory_order_release);
+        }
+        return n;
+    }
+
     bool empty() const {
         return m_head.load(std::memory_order_relaxed) == 
                m_tail.load(std::memory_order_relaxed);
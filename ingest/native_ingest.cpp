@@ -0,0 +1,418 @@
+#include "ingest/native_ingest.hpp"
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "bridge/shared_memory.hpp"
+#include "common/wait_strategy.hpp"
+#include "ingest/okx_json_parser.hpp"
+
+namespace quantumflow {
+
+namespace {
+
+uint64_t now_ns() {
+    return static_cast<uint64_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+}
+
+/// Base64 for the Sec-WebSocket-Key nonce (16 random bytes -> 24 chars).
+std::string base64(const unsigned char* data, size_t len) {
+    static const char tbl[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    out.reserve((len + 2) / 3 * 4);
+    for (size_t i = 0; i < len; i += 3) {
+        uint32_t v = static_cast<uint32_t>(data[i]) << 16;
+        if (i + 1 < len) v |= static_cast<uint32_t>(data[i + 1]) << 8;
+        if (i + 2 < len) v |= static_cast<uint32_t>(data[i + 2]);
+        out.push_back(tbl[(v >> 18) & 63]);
+        out.push_back(tbl[(v >> 12) & 63]);
+        out.push_back(i + 1 < len ? tbl[(v >> 6) & 63] : '=');
+        out.push_back(i + 2 < len ? tbl[v & 63] : '=');
+    }
+    return out;
+}
+
+bool send_all(int fd, const char* data, size_t len) {
+    while (len > 0) {
+        ssize_t n = ::send(fd, data, len, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += n;
+        len -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+} // namespace
+
+NativeIngest::NativeIngest(NativeIngestConfig cfg) : cfg_(std::move(cfg)) {}
+
+NativeIngest::~NativeIngest() { stop(); }
+
+bool NativeIngest::start() {
+    if (cfg_.symbols.empty()) {
+        std::fprintf(stderr, "[NativeIngest] no symbols configured\n");
+        return false;
+    }
+
+    // Parse scheme://host[:port]/path.
+    std::string rest;
+    if (cfg_.url.rfind("ws://", 0) == 0) {
+        rest = cfg_.url.substr(5);
+        port_ = "80";
+    } else if (cfg_.url.rfind("wss://", 0) == 0) {
+        std::fprintf(stderr,
+                     "[NativeIngest] wss:// needs TLS, which this build omits "
+                     "(LIBUS_NO_SSL); terminate TLS in a local proxy and use "
+                     "ws://127.0.0.1:<port>/...\n");
+        return false;
+    } else {
+        std::fprintf(stderr, "[NativeIngest] unsupported url: %s\n",
+                     cfg_.url.c_str());
+        return false;
+    }
+    const size_t slash = rest.find('/');
+    std::string hostport = (slash == std::string::npos) ? rest : rest.substr(0, slash);
+    path_ = (slash == std::string::npos) ? "/" : rest.substr(slash);
+    const size_t colon = hostport.find(':');
+    if (colon == std::string::npos) {
+        host_ = hostport;
+    } else {
+        host_ = hostport.substr(0, colon);
+        port_ = hostport.substr(colon + 1);
+    }
+    if (host_.empty()) {
+        std::fprintf(stderr, "[NativeIngest] no host in url: %s\n", cfg_.url.c_str());
+        return false;
+    }
+
+    producer_slot_ = global_bridge().register_producer();
+    if (producer_slot_ < 0) {
+        std::fprintf(stderr, "[NativeIngest] no free bridge producer slot\n");
+        return false;
+    }
+
+    running_.store(true, std::memory_order_release);
+    thread_ = std::thread([this] { run(); });
+    return true;
+}
+
+void NativeIngest::stop() {
+    running_.store(false, std::memory_order_release);
+    const int fd = socket_fd_.exchange(-1, std::memory_order_acq_rel);
+    if (fd >= 0) {
+        ::shutdown(fd, SHUT_RDWR);
+        ::close(fd);
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void NativeIngest::run() {
+    (void)pin_current_thread(cfg_.core);
+
+    // Reconnect loop with the same capped exponential backoff as the
+    // Python client (0.25 s doubling to 30 s).
+    int attempt = 0;
+    while (running_.load(std::memory_order_acquire)) {
+        if (connect_and_stream()) {
+            attempt = 0; // made it to streaming; restart the backoff
+        }
+        if (!running_.load(std::memory_order_acquire)) break;
+        reconnects_.fetch_add(1, std::memory_order_relaxed);
+        double delay_s = 0.25 * static_cast<double>(1u << (attempt < 7 ? attempt : 7));
+        if (delay_s > 30.0) delay_s = 30.0;
+        ++attempt;
+        struct timespec ts;
+        ts.tv_sec = static_cast<time_t>(delay_s);
+        ts.tv_nsec = static_cast<long>((delay_s - static_cast<double>(ts.tv_sec)) * 1e9);
+        nanosleep(&ts, nullptr);
+    }
+}
+
+bool NativeIngest::handshake(int fd, const std::string& host,
+                             const std::string& path) {
+    unsigned char nonce[16];
+    std::random_device rd;
+    for (unsigned char& b : nonce) b = static_cast<unsigned char>(rd());
+
+    std::string req;
+    req.reserve(256);
+    req += "GET " + path + " HTTP/1.1\r\n";
+    req += "Host: " + host + "\r\n";
+    req += "Upgrade: websocket\r\n";
+    req += "Connection: Upgrade\r\n";
+    req += "Sec-WebSocket-Key: " + base64(nonce, sizeof(nonce)) + "\r\n";
+    req += "Sec-WebSocket-Version: 13\r\n\r\n";
+    if (!send_all(fd, req.data(), req.size())) return false;
+
+    // Read headers until the blank line; require "101 Switching Protocols".
+    std::string response;
+    char buf[512];
+    while (response.find("\r\n\r\n") == std::string::npos) {
+        ssize_t n = ::recv(fd, buf, sizeof(buf), 0);
+        if (n <= 0) return false;
+        response.append(buf, static_cast<size_t>(n));
+        if (response.size() > 16 * 1024) return false;
+    }
+    return response.find(" 101 ") != std::string::npos;
+}
+
+bool NativeIngest::send_text_frame(int fd, const std::string& payload) {
+    // Client frames are masked per RFC 6455.
+    unsigned char header[14];
+    size_t hlen = 0;
+    header[hlen++] = 0x81; // FIN + text
+    const size_t len = payload.size();
+    if (len < 126) {
+        header[hlen++] = static_cast<unsigned char>(0x80 | len);
+    } else if (len <= 0xFFFF) {
+        header[hlen++] = 0x80 | 126;
+        header[hlen++] = static_cast<unsigned char>(len >> 8);
+        header[hlen++] = static_cast<unsigned char>(len);
+    } else {
+        header[hlen++] = 0x80 | 127;
+        for (int s = 56; s >= 0; s -= 8) {
+            header[hlen++] = static_cast<unsigned char>(len >> s);
+        }
+    }
+    unsigned char mask[4];
+    std::random_device rd;
+    for (unsigned char& b : mask) b = static_cast<unsigned char>(rd());
+    std::memcpy(header + hlen, mask, 4);
+    hlen += 4;
+
+    std::string masked = payload;
+    for (size_t i = 0; i < masked.size(); ++i) {
+        masked[i] = static_cast<char>(masked[i] ^ mask[i & 3]);
+    }
+    return send_all(fd, reinterpret_cast<const char*>(header), hlen) &&
+           send_all(fd, masked.data(), masked.size());
+}
+
+bool NativeIngest::send_pong(int fd, const char* payload, size_t len) {
+    if (len > 125) len = 125;
+    unsigned char frame[6 + 125];
+    frame[0] = 0x8A; // FIN + pong
+    frame[1] = static_cast<unsigned char>(0x80 | len);
+    unsigned char mask[4] = {0x12, 0x34, 0x56, 0x78};
+    std::memcpy(frame + 2, mask, 4);
+    for (size_t i = 0; i < len; ++i) {
+        frame[6 + i] = static_cast<unsigned char>(payload[i] ^ mask[i & 3]);
+    }
+    return send_all(fd, reinterpret_cast<const char*>(frame), 6 + len);
+}
+
+void NativeIngest::resubscribe(const std::string& symbol) {
+    bool known = false;
+    for (const auto& sym : cfg_.symbols) {
+        if (sym == symbol) {
+            known = true;
+            break;
+        }
+    }
+    if (!known) return;
+    {
+        std::lock_guard<std::mutex> lock(resub_mutex_);
+        for (const auto& sym : resub_symbols_) {
+            if (sym == symbol) return; // already queued
+        }
+        resub_symbols_.push_back(symbol);
+    }
+    resub_pending_.store(true, std::memory_order_release);
+}
+
+void NativeIngest::service_resubscribes(int fd) {
+    std::vector<std::string> symbols;
+    {
+        std::lock_guard<std::mutex> lock(resub_mutex_);
+        symbols.swap(resub_symbols_);
+        resub_pending_.store(false, std::memory_order_release);
+    }
+    for (const auto& sym : symbols) {
+        // Unsubscribe/subscribe only the book channels for this symbol;
+        // the exchange answers the resubscribe with a fresh snapshot.
+        // Trades keep flowing, and every other symbol is untouched.
+        for (const char* op : {"unsubscribe", "subscribe"}) {
+            std::string msg = std::string("{\"op\":\"") + op + "\",\"args\":[";
+            bool first = true;
+            for (const auto& ch : cfg_.channels) {
+                if (ch.rfind("books", 0) != 0) continue;
+                if (!first) msg.push_back(',');
+                first = false;
+                msg += "{\"channel\":\"" + ch + "\",\"instId\":\"" + sym + "\"}";
+            }
+            msg += "]}";
+            if (first) return; // no book channels configured
+            if (!send_text_frame(fd, msg)) return;
+        }
+        resubscribes_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void NativeIngest::announce_symbol_config() {
+    // Same session-start scale negotiation as the Python sink: one
+    // EVENT_SYMBOL_CONFIG per symbol before any data flows.
+    auto& bridge = global_bridge();
+    for (const auto& sym : cfg_.symbols) {
+        MarketDataPacket pkt{};
+        std::snprintf(pkt.symbol, sizeof(pkt.symbol), "%s", sym.c_str());
+        pkt.event_type = EVENT_SYMBOL_CONFIG;
+        pkt.price = cfg_.price_scale;
+        pkt.quantity = cfg_.qty_scale;
+        pkt.timestamp_ns = now_ns();
+        while (!bridge.push(producer_slot_, pkt)) {
+            struct timespec ts = {0, 100000}; // config must not be dropped
+            nanosleep(&ts, nullptr);
+        }
+    }
+}
+
+bool NativeIngest::connect_and_stream() {
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* res = nullptr;
+    if (::getaddrinfo(host_.c_str(), port_.c_str(), &hints, &res) != 0 || !res) {
+        return false;
+    }
+
+    int fd = -1;
+    for (addrinfo* ai = res; ai; ai = ai->ai_next) {
+        fd = ::socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (fd < 0) continue;
+        if (::connect(fd, ai->ai_addr, ai->ai_addrlen) == 0) break;
+        ::close(fd);
+        fd = -1;
+    }
+    ::freeaddrinfo(res);
+    if (fd < 0) return false;
+
+    int one = 1;
+    (void)::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    socket_fd_.store(fd, std::memory_order_release);
+
+    bool streamed = false;
+    do {
+        if (!handshake(fd, host_, path_)) break;
+
+        // Subscribe to every (channel, symbol) pair, OKX style.
+        std::string sub = "{\"op\":\"subscribe\",\"args\":[";
+        bool first = true;
+        for (const auto& ch : cfg_.channels) {
+            for (const auto& sym : cfg_.symbols) {
+                if (!first) sub.push_back(',');
+                first = false;
+                sub += "{\"channel\":\"" + ch + "\",\"instId\":\"" + sym + "\"}";
+            }
+        }
+        sub += "]}";
+        if (!send_text_frame(fd, sub)) break;
+
+        announce_symbol_config();
+        streamed = true;
+
+        auto& bridge = global_bridge();
+        std::vector<char> buf;   // unparsed frame bytes
+        std::string fragments;   // continuation-frame reassembly
+        char chunk[64 * 1024];
+
+        while (running_.load(std::memory_order_acquire)) {
+            ssize_t n = ::recv(fd, chunk, sizeof(chunk), 0);
+            if (n <= 0) {
+                if (n < 0 && errno == EINTR) continue;
+                break;
+            }
+            const uint64_t recv_ns = now_ns();
+            buf.insert(buf.end(), chunk, chunk + n);
+
+            // Drain complete frames from the buffer.
+            size_t off = 0;
+            while (buf.size() - off >= 2) {
+                const unsigned char b0 = static_cast<unsigned char>(buf[off]);
+                const unsigned char b1 = static_cast<unsigned char>(buf[off + 1]);
+                const bool fin = (b0 & 0x80) != 0;
+                const unsigned opcode = b0 & 0x0F;
+                const bool masked = (b1 & 0x80) != 0; // servers must not mask
+                uint64_t plen = b1 & 0x7F;
+                size_t hdr = 2;
+                if (plen == 126) {
+                    if (buf.size() - off < 4) break;
+                    plen = (static_cast<uint64_t>(
+                                static_cast<unsigned char>(buf[off + 2])) << 8) |
+                           static_cast<unsigned char>(buf[off + 3]);
+                    hdr = 4;
+                } else if (plen == 127) {
+                    if (buf.size() - off < 10) break;
+                    plen = 0;
+                    for (int i = 0; i < 8; ++i) {
+                        plen = (plen << 8) |
+                               static_cast<unsigned char>(buf[off + 2 + i]);
+                    }
+                    hdr = 10;
+                }
+                if (masked) hdr += 4;
+                if (buf.size() - off < hdr + plen) break;
+
+                const char* payload = buf.data() + off + hdr;
+                if (opcode == 0x9) { // ping
+                    (void)send_pong(fd, payload, static_cast<size_t>(plen));
+                } else if (opcode == 0x8) { // close
+                    off = buf.size();
+                    goto connection_closed;
+                } else if (opcode == 0x1 || opcode == 0x2 || opcode == 0x0) {
+                    const char* msg = payload;
+                    size_t msg_len = static_cast<size_t>(plen);
+                    if (!fin || opcode == 0x0) {
+                        fragments.append(payload, msg_len);
+                        if (!fin) {
+                            off += hdr + plen;
+                            continue;
+                        }
+                        msg = fragments.data();
+                        msg_len = fragments.size();
+                    }
+                    size_t emitted = parser_.parse(
+                        msg, msg_len, cfg_.price_scale, cfg_.qty_scale,
+                        recv_ns, [&](const MarketDataPacket& pkt) {
+                            (void)bridge.push(producer_slot_, pkt);
+                        });
+                    packets_emitted_.fetch_add(emitted,
+                                               std::memory_order_relaxed);
+                    messages_parsed_.fetch_add(1, std::memory_order_relaxed);
+                    if (!fragments.empty()) fragments.clear();
+                }
+                off += hdr + plen;
+            }
+            if (off > 0) {
+                buf.erase(buf.begin(), buf.begin() + static_cast<long>(off));
+            }
+            if (resub_pending_.load(std::memory_order_acquire)) {
+                service_resubscribes(fd);
+            }
+        }
+    connection_closed:;
+    } while (false);
+
+    const int stored = socket_fd_.exchange(-1, std::memory_order_acq_rel);
+    if (stored >= 0) {
+        ::close(stored);
+    }
+    return streamed;
+}
+
+} // namespace quantumflow
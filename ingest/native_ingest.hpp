@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ingest/okx_json_parser.hpp"
+
+namespace quantumflow {
+
+/// Configuration for one native exchange ingest connection.
+/// Scales mirror the Python bridge sink defaults; both sides announce them
+/// via EVENT_SYMBOL_CONFIG so the consumer needs no out-of-band agreement.
+struct NativeIngestConfig {
+    std::string url = "ws://ws.okx.com:8443/ws/v5/public";
+    std::vector<std::string> symbols;
+    std::vector<std::string> channels = {"books5", "trades"};
+    uint64_t price_scale = 100;
+    uint64_t qty_scale = 100000000; // 1e8, matching the Python sink
+    int core = -1;                  // pin the ingest thread (-1 = unpinned)
+};
+
+/// Native C++ exchange ingest: a WebSocket client that connects to the
+/// exchange, parses depth/trade JSON with OkxJsonParser and pushes
+/// MarketDataPacket straight into global_bridge() in-process — no Python
+/// normalizer, no UDS hop. Selectable per symbol, so the Python pipeline
+/// remains in place for exchanges without native support.
+///
+/// The transport is a hand-rolled RFC 6455 client over plain TCP (the
+/// vendored uWebSockets is server-only and the tree builds LIBUS_NO_SSL):
+/// ws:// endpoints connect directly; wss:// exchanges terminate TLS in a
+/// local proxy (stunnel or equivalent) and point the url at it.
+class NativeIngest {
+public:
+    explicit NativeIngest(NativeIngestConfig cfg);
+    ~NativeIngest();
+
+    NativeIngest(const NativeIngest&) = delete;
+    NativeIngest& operator=(const NativeIngest&) = delete;
+
+    /// Spawn the ingest thread. Returns false on unusable config (no
+    /// symbols, wss:// url, or no free bridge producer slot).
+    bool start();
+
+    /// Signal the thread, close the socket and join. Idempotent.
+    void stop();
+
+    /// Targeted single-symbol resync: queue an unsubscribe/subscribe for
+    /// the symbol's book channels; the exchange answers the resubscribe
+    /// with a fresh snapshot. Callable from any thread (the consumer uses
+    /// it on a checksum mismatch); the ingest thread picks the request up
+    /// between frames. Unknown symbols are ignored.
+    void resubscribe(const std::string& symbol);
+
+    uint64_t packets_emitted() const {
+        return packets_emitted_.load(std::memory_order_relaxed);
+    }
+    uint64_t messages_parsed() const {
+        return messages_parsed_.load(std::memory_order_relaxed);
+    }
+    uint64_t reconnects() const {
+        return reconnects_.load(std::memory_order_relaxed);
+    }
+    uint64_t resubscribes() const {
+        return resubscribes_.load(std::memory_order_relaxed);
+    }
+
+private:
+    void run();
+    bool connect_and_stream();
+    bool handshake(int fd, const std::string& host, const std::string& path);
+    bool send_text_frame(int fd, const std::string& payload);
+    bool send_pong(int fd, const char* payload, size_t len);
+    void announce_symbol_config();
+    void service_resubscribes(int fd);
+
+    NativeIngestConfig cfg_;
+    OkxJsonParser parser_; // owned by the ingest thread (books5 diff state)
+    std::string host_;
+    std::string port_;
+    std::string path_;
+
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::atomic<int> socket_fd_{-1};
+    int producer_slot_ = -1;
+
+    std::atomic<uint64_t> packets_emitted_{0};
+    std::atomic<uint64_t> messages_parsed_{0};
+    std::atomic<uint64_t> reconnects_{0};
+    std::atomic<uint64_t> resubscribes_{0};
+
+    // Pending resync requests: flag checked per frame-drain pass, list
+    // drained under the mutex only when it is set.
+    std::atomic<bool> resub_pending_{false};
+    std::mutex resub_mutex_;
+    std::vector<std::string> resub_symbols_;
+};
+
+} // namespace quantumflow
@@ -0,0 +1,376 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#include "LOB/Checksum.h"
+#include "common/market_data_packet.hpp"
+
+namespace quantumflow {
+
+/// SAX-style parser for OKX public-channel JSON (books*/trades) straight
+/// into MarketDataPacket, replacing the Python normalizer hop for symbols
+/// served by the native ingest path.
+///
+/// The parser scans the message buffer in place: no DOM, no allocation
+/// on the hot path, no double round-trip. Price/size strings convert
+/// directly to the integer wire representation ("41006.8" with scale 100
+/// -> 4100680), so the packets it emits are byte-identical in meaning to
+/// what the Python bridge sink produces. Non-data messages (subscribe
+/// acks, errors, pongs) parse to zero packets.
+///
+/// books5 handling is stateful: pushes are full snapshots, but the
+/// consumer applies levels as upserts, so a price that simply vanishes
+/// from one push to the next would linger in the consumer's book and
+/// trip the checksum. The parser keeps the previous snapshot's prices
+/// per symbol and emits qty-0 removals for vanished levels before the
+/// checksum packet. Use one parser instance per feed connection.
+class OkxJsonParser {
+public:
+    /// Parse one WebSocket text message. emit(const MarketDataPacket&) is
+    /// invoked once per book level / trade, in message order. recv_ns is
+    /// stamped into every packet's timestamp_ns (monotonic, same clock as
+    /// the consumer's ingest stamp). Returns the number of packets emitted.
+    template <typename Emit>
+    size_t parse(const char* data, size_t len, uint64_t price_scale,
+                 uint64_t qty_scale, uint64_t recv_ns, Emit&& emit) {
+        const char* end = data + len;
+
+        // Control messages carry "event" ("subscribe"/"error"); data
+        // messages never do at the top level before "arg".
+        const char* arg = find(data, end, "\"arg\"");
+        if (!arg) return 0;
+
+        const char* chan_begin;
+        size_t chan_len;
+        if (!extract_string(arg, end, "\"channel\"", chan_begin, chan_len)) {
+            return 0;
+        }
+        const char* inst_begin;
+        size_t inst_len;
+        if (!extract_string(arg, end, "\"instId\"", inst_begin, inst_len)) {
+            return 0;
+        }
+
+        const char* data_arr = find(arg, end, "\"data\"");
+        if (!data_arr) return 0;
+
+        MarketDataPacket pkt{};
+        copy_symbol(pkt.symbol, inst_begin, inst_len);
+        pkt.timestamp_ns = recv_ns;
+
+        if (chan_len >= 5 && std::memcmp(chan_begin, "books", 5) == 0) {
+            size_t emitted = 0;
+            ChecksumLevel bids[BookChecksum::DEPTH];
+            ChecksumLevel asks[BookChecksum::DEPTH];
+            size_t n_bids = 0;
+            size_t n_asks = 0;
+            auto collect = [&](const MarketDataPacket& p) {
+                if (p.quantity > 0) {
+                    if (p.side == 0 && n_bids < BookChecksum::DEPTH) {
+                        bids[n_bids++] = {p.price, p.quantity};
+                    } else if (p.side == 1 && n_asks < BookChecksum::DEPTH) {
+                        asks[n_asks++] = {p.price, p.quantity};
+                    }
+                }
+                emit(p);
+            };
+            pkt.event_type = EVENT_BOOK_LEVEL;
+            pkt.side = 1;
+            emitted += parse_levels(data_arr, end, "\"asks\"", price_scale,
+                                    qty_scale, pkt, collect);
+            pkt.side = 0;
+            emitted += parse_levels(data_arr, end, "\"bids\"", price_scale,
+                                    qty_scale, pkt, collect);
+            // books5 pushes are full snapshots, so the message alone
+            // determines what the consumer's book must contain: diff
+            // against the previous snapshot to retire prices that
+            // vanished (the consumer applies levels as upserts), then
+            // follow with the canonical checksum over the new levels and
+            // let the consumer verify per update. Incremental channels
+            // ("books") carry explicit removals and would need
+            // venue-state tracking here, so neither applies there.
+            if (chan_len == 6 && std::memcmp(chan_begin, "books5", 6) == 0 &&
+                emitted > 0) {
+                PrevSnapshot& prev = prev_books_[pkt.symbol];
+                pkt.event_type = EVENT_BOOK_LEVEL;
+                pkt.side = 1;
+                emitted += emit_vanished(prev.asks, asks, n_asks, pkt, emit);
+                pkt.side = 0;
+                emitted += emit_vanished(prev.bids, bids, n_bids, pkt, emit);
+                record_side(prev.asks, asks, n_asks);
+                record_side(prev.bids, bids, n_bids);
+
+                pkt.event_type = EVENT_BOOK_CHECKSUM;
+                pkt.side = 0;
+                pkt.price = BookChecksum::compute(bids, n_bids, asks, n_asks);
+                pkt.quantity = n_bids > n_asks ? n_bids : n_asks;
+                emit(static_cast<const MarketDataPacket&>(pkt));
+                ++emitted;
+            }
+            return emitted;
+        }
+        if (chan_len == 6 && std::memcmp(chan_begin, "trades", 6) == 0) {
+            return parse_trades(data_arr, end, price_scale, qty_scale, pkt,
+                                emit);
+        }
+        return 0;
+    }
+
+    /// Decimal string -> scaled integer without a double round-trip:
+    /// "41006.8" at scale 100 becomes 4100680, rounding half-up on excess
+    /// fractional digits. Returns false on malformed input or overflow.
+    /// Scales are powers of ten (the wire protocol announces them as such).
+    static bool parse_scaled(const char* begin, const char* end,
+                             uint64_t scale, uint64_t& out) {
+        if (begin >= end) return false;
+
+        uint64_t acc = 0;
+        int frac_digits = -1; // -1 until the decimal point is seen
+        const int scale_digits = pow10_digits(scale);
+        if (scale_digits < 0) return false;
+
+        for (const char* p = begin; p < end; ++p) {
+            const char c = *p;
+            if (c == '.') {
+                if (frac_digits >= 0) return false;
+                frac_digits = 0;
+                continue;
+            }
+            if (c < '0' || c > '9') return false;
+            if (frac_digits >= scale_digits) {
+                // Past the precision the scale can hold: round half-up on
+                // the first excess digit, ignore the rest.
+                if (frac_digits == scale_digits && c >= '5') acc += 1;
+                ++frac_digits;
+                continue;
+            }
+            if (acc > (UINT64_MAX - 9) / 10) return false;
+            acc = acc * 10 + static_cast<uint64_t>(c - '0');
+            if (frac_digits >= 0) ++frac_digits;
+        }
+
+        int missing = scale_digits - (frac_digits < 0 ? 0 : frac_digits);
+        while (missing > 0 && missing <= scale_digits) {
+            if (acc > UINT64_MAX / 10) return false;
+            acc *= 10;
+            --missing;
+        }
+        out = acc;
+        return true;
+    }
+
+private:
+    /// Prices held at the last books5 push, one array per side. Sizes are
+    /// bounded by the checksum depth, which books5's five levels never
+    /// reach.
+    struct SideLevels {
+        uint64_t prices[BookChecksum::DEPTH];
+        size_t count = 0;
+    };
+    struct PrevSnapshot {
+        SideLevels bids;
+        SideLevels asks;
+    };
+
+    /// Emit a qty-0 removal for every previous price absent from the new
+    /// snapshot. pkt carries symbol/side/timestamp; price and quantity
+    /// are overwritten per removal.
+    template <typename Emit>
+    static size_t emit_vanished(const SideLevels& prev,
+                                const ChecksumLevel* cur, size_t n_cur,
+                                MarketDataPacket& pkt, Emit&& emit) {
+        size_t emitted = 0;
+        for (size_t i = 0; i < prev.count; ++i) {
+            bool present = false;
+            for (size_t j = 0; j < n_cur; ++j) {
+                if (cur[j].price == prev.prices[i]) {
+                    present = true;
+                    break;
+                }
+            }
+            if (present) continue;
+            pkt.price = prev.prices[i];
+            pkt.quantity = 0;
+            emit(static_cast<const MarketDataPacket&>(pkt));
+            ++emitted;
+        }
+        return emitted;
+    }
+
+    static void record_side(SideLevels& prev, const ChecksumLevel* cur,
+                            size_t n) {
+        if (n > BookChecksum::DEPTH) n = BookChecksum::DEPTH;
+        for (size_t i = 0; i < n; ++i) {
+            prev.prices[i] = cur[i].price;
+        }
+        prev.count = n;
+    }
+
+    static const char* find(const char* p, const char* end, const char* needle) {
+        const size_t n = std::strlen(needle);
+        if (p >= end || static_cast<size_t>(end - p) < n) return nullptr;
+        const char* last = end - n;
+        for (; p <= last; ++p) {
+            if (*p == needle[0] && std::memcmp(p, needle, n) == 0) return p;
+        }
+        return nullptr;
+    }
+
+    /// Locate "key":"value" after p; value must be a JSON string.
+    static bool extract_string(const char* p, const char* end, const char* key,
+                               const char*& value_begin, size_t& value_len) {
+        const char* k = find(p, end, key);
+        if (!k) return false;
+        k += std::strlen(key);
+        while (k < end && (*k == ':' || *k == ' ')) ++k;
+        if (k >= end || *k != '"') return false;
+        ++k;
+        const char* close = static_cast<const char*>(
+            std::memchr(k, '"', static_cast<size_t>(end - k)));
+        if (!close) return false;
+        value_begin = k;
+        value_len = static_cast<size_t>(close - k);
+        return true;
+    }
+
+    static void copy_symbol(char (&dst)[16], const char* src, size_t len) {
+        std::memset(dst, 0, sizeof(dst));
+        if (len >= sizeof(dst)) len = sizeof(dst) - 1;
+        std::memcpy(dst, src, len);
+    }
+
+    /// Number of decimal digits in a power-of-ten scale, or -1 otherwise.
+    static int pow10_digits(uint64_t scale) {
+        int digits = 0;
+        while (scale > 1) {
+            if (scale % 10 != 0) return -1;
+            scale /= 10;
+            ++digits;
+        }
+        return scale == 1 ? digits : -1;
+    }
+
+    /// Parse "key":[["px","sz",...],...] emitting one packet per level.
+    template <typename Emit>
+    static size_t parse_levels(const char* p, const char* end, const char* key,
+                               uint64_t price_scale, uint64_t qty_scale,
+                               MarketDataPacket& pkt, Emit&& emit) {
+        const char* k = find(p, end, key);
+        if (!k) return 0;
+        k = static_cast<const char*>(
+            std::memchr(k, '[', static_cast<size_t>(end - k)));
+        if (!k) return 0;
+        ++k; // inside the outer array
+
+        size_t emitted = 0;
+        while (k < end) {
+            while (k < end && (*k == ',' || *k == ' ' || *k == '\n')) ++k;
+            if (k >= end || *k == ']') break; // outer array done
+            if (*k != '[') break;
+            ++k; // inside one level
+
+            const char* px_begin;
+            size_t px_len;
+            const char* sz_begin;
+            size_t sz_len;
+            if (!next_array_string(k, end, px_begin, px_len) ||
+                !next_array_string(k, end, sz_begin, sz_len)) {
+                break;
+            }
+
+            // Skip the rest of the level ("liquidated", order count).
+            const char* close = static_cast<const char*>(
+                std::memchr(k, ']', static_cast<size_t>(end - k)));
+            if (!close) break;
+            k = close + 1;
+
+            uint64_t price, qty;
+            if (!parse_scaled(px_begin, px_begin + px_len, price_scale, price) ||
+                !parse_scaled(sz_begin, sz_begin + sz_len, qty_scale, qty)) {
+                continue;
+            }
+            pkt.price = price;
+            pkt.quantity = qty; // 0 removes the level, as on the Python path
+            emit(static_cast<const MarketDataPacket&>(pkt));
+            ++emitted;
+        }
+        return emitted;
+    }
+
+    /// Parse the trades "data" array: one packet per trade object.
+    template <typename Emit>
+    static size_t parse_trades(const char* p, const char* end,
+                               uint64_t price_scale, uint64_t qty_scale,
+                               MarketDataPacket& pkt, Emit&& emit) {
+        pkt.event_type = EVENT_TRADE;
+        size_t emitted = 0;
+        const char* k = static_cast<const char*>(
+            std::memchr(p, '[', static_cast<size_t>(end - p)));
+        if (!k) return 0;
+        ++k;
+
+        while (k < end) {
+            const char* obj = static_cast<const char*>(
+                std::memchr(k, '{', static_cast<size_t>(end - k)));
+            if (!obj) break;
+            const char* obj_end = static_cast<const char*>(
+                std::memchr(obj, '}', static_cast<size_t>(end - obj)));
+            if (!obj_end) break;
+            k = obj_end + 1;
+
+            const char* px_begin;
+            size_t px_len;
+            const char* sz_begin;
+            size_t sz_len;
+            const char* side_begin;
+            size_t side_len;
+            if (!extract_string(obj, obj_end, "\"px\"", px_begin, px_len) ||
+                !extract_string(obj, obj_end, "\"sz\"", sz_begin, sz_len) ||
+                !extract_string(obj, obj_end, "\"side\"", side_begin, side_len)) {
+                continue;
+            }
+
+            uint64_t price, qty;
+            if (!parse_scaled(px_begin, px_begin + px_len, price_scale, price) ||
+                !parse_scaled(sz_begin, sz_begin + sz_len, qty_scale, qty)) {
+                continue;
+            }
+            pkt.price = price;
+            pkt.quantity = qty;
+            pkt.side = (side_len == 3 && std::memcmp(side_begin, "buy", 3) == 0)
+                           ? 0
+                           : 1;
+            emit(static_cast<const MarketDataPacket&>(pkt));
+            ++emitted;
+        }
+        return emitted;
+    }
+
+    /// Advance past the next JSON string inside an array, returning its
+    /// bounds. p is left after the closing quote.
+    static bool next_array_string(const char*& p, const char* end,
+                                  const char*& value_begin, size_t& value_len) {
+        const char* open = static_cast<const char*>(
+            std::memchr(p, '"', static_cast<size_t>(end - p)));
+        if (!open) return false;
+        ++open;
+        const char* close = static_cast<const char*>(
+            std::memchr(open, '"', static_cast<size_t>(end - open)));
+        if (!close) return false;
+        value_begin = open;
+        value_len = static_cast<size_t>(close - open);
+        p = close + 1;
+        return true;
+    }
+
+    // Previous books5 snapshot per symbol, for the vanish diff. Survives
+    // reconnects on purpose: the consumer's book also survives them, so
+    // the first post-reconnect push must still retire stale prices.
+    std::unordered_map<std::string, PrevSnapshot> prev_books_;
+};
+
+} // namespace quantumflow
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "LOB/Book.h"
+
+namespace quantumflow {
+
+/// Book image layout: one header followed by the bid levels (best first)
+/// and then the ask levels (best first). Prices are internal integer
+/// ticks, exactly what set_level consumes, so restore is a straight
+/// replay with no float round-trips.
+inline constexpr uint32_t QF_BOOK_IMAGE_MAGIC = 0x49424651; // "QFBI"
+inline constexpr uint32_t QF_BOOK_IMAGE_VERSION = 1;
+
+struct BookImageHeader {
+    uint32_t magic;
+    uint32_t version;
+    char symbol[16];
+    uint64_t saved_ns;
+    uint32_t bid_count;
+    uint32_t ask_count;
+};
+
+struct BookImageLevel {
+    PRICE price;
+    uint32_t order_count;
+    Volume volume;
+};
+
+static_assert(sizeof(BookImageLevel) == 16,
+              "Image level entries are copied as a flat array");
+
+inline std::string book_image_path(const std::string& dir,
+                                   const std::string& symbol) {
+    return dir + "/" + symbol + ".book";
+}
+
+/// Serialize the book's level lists into a compact binary image, written
+/// atomically (temp file + rename) so a crash mid-write leaves the
+/// previous image intact. Returns false on any syscall failure.
+inline bool write_book_image(Book& book, const std::string& symbol,
+                             const std::string& path, uint64_t saved_ns) {
+    BookImageHeader header{};
+    header.magic = QF_BOOK_IMAGE_MAGIC;
+    header.version = QF_BOOK_IMAGE_VERSION;
+    std::snprintf(header.symbol, sizeof(header.symbol), "%s", symbol.c_str());
+    header.saved_ns = saved_ns;
+
+    const std::vector<PRICE> bid_prices = book.get_buy_prices();
+    const std::vector<PRICE> ask_prices = book.get_sell_prices();
+    header.bid_count = static_cast<uint32_t>(bid_prices.size());
+    header.ask_count = static_cast<uint32_t>(ask_prices.size());
+
+    std::vector<char> image;
+    image.reserve(sizeof(header) +
+                  (bid_prices.size() + ask_prices.size()) *
+                      sizeof(BookImageLevel));
+    image.insert(image.end(), reinterpret_cast<const char*>(&header),
+                 reinterpret_cast<const char*>(&header) + sizeof(header));
+
+    auto append_side = [&](const std::vector<PRICE>& prices,
+                           PriceLevelMap& limits) {
+        for (PRICE price : prices) {
+            auto it = limits.find(price);
+            if (it == limits.end()) continue;
+            BookImageLevel lvl{};
+            lvl.price = price;
+            lvl.order_count = static_cast<uint32_t>(it->second->get_order_number());
+            lvl.volume = it->second->get_total_volume();
+            image.insert(image.end(), reinterpret_cast<const char*>(&lvl),
+                         reinterpret_cast<const char*>(&lvl) + sizeof(lvl));
+        }
+    };
+    append_side(bid_prices, book.get_buy_limits());
+    append_side(ask_prices, book.get_sell_limits());
+
+    const std::string tmp = path + ".tmp";
+    int fd = ::open(tmp.c_str(), O_CREAT | O_WRONLY | O_TRUNC, 0644);
+    if (fd < 0) {
+        std::fprintf(stderr, "Failed to open book image %s: %s\n",
+                     tmp.c_str(), std::strerror(errno));
+        return false;
+    }
+    const char* data = image.data();
+    size_t remaining = image.size();
+    while (remaining > 0) {
+        ssize_t n = ::write(fd, data, remaining);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            ::close(fd);
+            (void)::unlink(tmp.c_str());
+            return false;
+        }
+        data += n;
+        remaining -= static_cast<size_t>(n);
+    }
+    ::close(fd);
+
+    if (::rename(tmp.c_str(), path.c_str()) != 0) {
+        std::fprintf(stderr, "Failed to publish book image %s: %s\n",
+                     path.c_str(), std::strerror(errno));
+        (void)::unlink(tmp.c_str());
+        return false;
+    }
+    return true;
+}
+
+/// Restore a book from an image: mmap the file and replay every level
+/// through the set_level fast path before the first packet is processed.
+/// Missing files are a quiet no-op (first run, new symbol); corrupt
+/// images are reported and skipped. Returns the number of levels
+/// restored; saved_ns (if non-null) receives the image timestamp.
+inline size_t restore_book_image(Book& book, const std::string& path,
+                                 uint64_t* saved_ns = nullptr) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return 0; // no image yet: cold start for this symbol
+    }
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 ||
+        static_cast<size_t>(st.st_size) < sizeof(BookImageHeader)) {
+        std::fprintf(stderr, "Book image %s is truncated\n", path.c_str());
+        ::close(fd);
+        return 0;
+    }
+    const size_t mapped_size = static_cast<size_t>(st.st_size);
+
+    void* base = ::mmap(nullptr, mapped_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        std::fprintf(stderr, "Failed to map book image %s: %s\n", path.c_str(),
+                     std::strerror(errno));
+        return 0;
+    }
+
+    size_t restored = 0;
+    const auto* header = static_cast<const BookImageHeader*>(base);
+    do {
+        if (header->magic != QF_BOOK_IMAGE_MAGIC ||
+            header->version != QF_BOOK_IMAGE_VERSION) {
+            std::fprintf(stderr, "Book image %s: bad magic/version\n",
+                         path.c_str());
+            break;
+        }
+        const size_t total =
+            static_cast<size_t>(header->bid_count) + header->ask_count;
+        if (mapped_size <
+            sizeof(BookImageHeader) + total * sizeof(BookImageLevel)) {
+            std::fprintf(stderr, "Book image %s: level count exceeds file\n",
+                         path.c_str());
+            break;
+        }
+
+        const auto* levels = reinterpret_cast<const BookImageLevel*>(
+            static_cast<const char*>(base) + sizeof(BookImageHeader));
+        for (uint32_t i = 0; i < header->bid_count; ++i) {
+            book.set_level(BUY, levels[i].price, levels[i].volume);
+            ++restored;
+        }
+        for (uint32_t i = 0; i < header->ask_count; ++i) {
+            const BookImageLevel& lvl = levels[header->bid_count + i];
+            book.set_level(SELL, lvl.price, lvl.volume);
+            ++restored;
+        }
+        if (saved_ns) *saved_ns = header->saved_ns;
+    } while (false);
+
+    ::munmap(base, mapped_size);
+    return restored;
+}
+
+} // namespace quantumflow
@@ -0,0 +1,375 @@
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "common/symbol_table.hpp"
+#include "common/wait_strategy.hpp"
+#include "memory/allocator.h"
+
+namespace quantumflow {
+
+/// Journal file layout: a fixed 4 KiB header followed by a flat array of
+/// JournalRecord, written in O_DIRECT-friendly aligned chunks. Same shape
+/// as the packet capture format so the reader side is one mmap away from
+/// post-trade analysis.
+inline constexpr uint32_t QF_JOURNAL_MAGIC = 0x4A544651; // "QFTJ"
+inline constexpr uint32_t QF_JOURNAL_VERSION = 1;
+inline constexpr size_t QF_JOURNAL_HEADER_SIZE = 4096; // one page, mmap-aligned
+
+struct JournalFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t record_count;  // exact count; trailing chunk padding is ignored
+    uint64_t first_trade_ns;
+    uint64_t last_trade_ns;
+};
+
+/// One journaled fill: TradeInfo plus the symbol and the per-symbol trade
+/// sequence it carried. Padded to one cache line so chunk sizes stay
+/// page-aligned and records never straddle lines.
+struct JournalRecord {
+    uint64_t sequence;
+    uint64_t timestamp_ns;
+    double price;
+    uint64_t quantity;
+    SymbolId symbol;
+    uint8_t side;
+    uint8_t _pad[27];
+};
+
+static_assert(sizeof(JournalRecord) == 64,
+              "Journal record must stay 64 bytes (one cache line) so chunk "
+              "sizes remain page-aligned");
+
+/// Append-only binary trade journal with an asynchronous double-buffered
+/// writer.
+///
+/// The hot path calls append(): one lock-free ring push, no syscalls, no
+/// locks — the matching thread never blocks on disk. A dedicated writer
+/// thread drains the staging ring into one of two page-aligned chunk
+/// buffers and hands full chunks to write() while the other buffer keeps
+/// filling, so a slow device shows up as ring backpressure (and a dropped
+/// counter), never as hot-path latency. Buffers, sizes and file offsets
+/// are 4 KiB-aligned throughout, so the file can optionally be opened
+/// O_DIRECT to keep journal traffic out of the page cache.
+class TradeJournalWriter {
+public:
+    static constexpr size_t RING_CAPACITY = 65536;
+    static constexpr size_t CHUNK_BYTES = 1 << 20; // 1 MiB per write()
+    static constexpr size_t CHUNK_RECORDS = CHUNK_BYTES / sizeof(JournalRecord);
+    static constexpr size_t ALIGNMENT = 4096;
+
+    TradeJournalWriter() = default;
+
+    ~TradeJournalWriter() { close(); }
+
+    TradeJournalWriter(const TradeJournalWriter&) = delete;
+    TradeJournalWriter& operator=(const TradeJournalWriter&) = delete;
+
+    /// Create (truncate) the journal and start the writer thread.
+    /// use_direct opens O_DIRECT, falling back to buffered I/O where the
+    /// filesystem refuses it. Returns false on any syscall failure; the
+    /// caller runs on without journaling.
+    bool open(const std::string& path, bool use_direct = false) {
+        if (fd_ >= 0) return true;
+
+        int flags = O_CREAT | O_WRONLY | O_TRUNC;
+#ifdef O_DIRECT
+        if (use_direct) flags |= O_DIRECT;
+#endif
+        fd_ = ::open(path.c_str(), flags, 0644);
+#ifdef O_DIRECT
+        if (fd_ < 0 && use_direct) {
+            fd_ = ::open(path.c_str(), O_CREAT | O_WRONLY | O_TRUNC, 0644);
+        }
+#endif
+        if (fd_ < 0) {
+            std::fprintf(stderr, "Failed to open journal %s: %s\n",
+                         path.c_str(), std::strerror(errno));
+            return false;
+        }
+
+        for (int i = 0; i < 2; ++i) {
+            buffers_[i] = static_cast<char*>(
+                std::aligned_alloc(ALIGNMENT, CHUNK_BYTES));
+            if (!buffers_[i]) {
+                close_fd_and_buffers();
+                return false;
+            }
+        }
+        header_block_ = static_cast<char*>(
+            std::aligned_alloc(ALIGNMENT, QF_JOURNAL_HEADER_SIZE));
+        if (!header_block_) {
+            close_fd_and_buffers();
+            return false;
+        }
+        std::memset(header_block_, 0, QF_JOURNAL_HEADER_SIZE);
+        header().magic = QF_JOURNAL_MAGIC;
+        header().version = QF_JOURNAL_VERSION;
+        if (!write_header()) {
+            close_fd_and_buffers();
+            return false;
+        }
+
+        path_ = path;
+        running_.store(true, std::memory_order_release);
+        writer_ = std::thread([this] { writer_loop(); });
+        return true;
+    }
+
+    bool is_open() const { return fd_ >= 0; }
+
+    /// Hot-path append: one SPSC ring push. Returns false when the ring is
+    /// full (writer behind the device); the record is dropped and counted
+    /// rather than ever blocking the matching thread.
+    bool append(const JournalRecord& rec) {
+        if (ring_.tryPush(rec)) {
+            return true;
+        }
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    uint64_t written_count() const {
+        return written_.load(std::memory_order_relaxed);
+    }
+    uint64_t dropped_count() const {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    /// Stop the writer thread, flush everything staged, finalize the
+    /// header and close the file.
+    void close() {
+        if (fd_ < 0) return;
+        running_.store(false, std::memory_order_release);
+        if (writer_.joinable()) {
+            writer_.join();
+        }
+        close_fd_and_buffers();
+    }
+
+private:
+    JournalFileHeader& header() {
+        return *reinterpret_cast<JournalFileHeader*>(header_block_);
+    }
+
+    bool write_header() {
+        return ::pwrite(fd_, header_block_, QF_JOURNAL_HEADER_SIZE, 0) ==
+               static_cast<ssize_t>(QF_JOURNAL_HEADER_SIZE);
+    }
+
+    /// Write records at the next file position. Every flush except the
+    /// final one covers a whole number of pages, so file offsets stay
+    /// ALIGNMENT-multiples; the final flush pads its tail with zeros (the
+    /// header's record_count marks where real data ends, and close() trims
+    /// the padding back off).
+    bool write_records(char* buf, size_t records) {
+        size_t bytes = records * sizeof(JournalRecord);
+        const size_t padded = (bytes + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+        if (padded > bytes) {
+            std::memset(buf + bytes, 0, padded - bytes);
+        }
+        const uint64_t done = written_.load(std::memory_order_relaxed);
+        const off_t offset = static_cast<off_t>(
+            QF_JOURNAL_HEADER_SIZE + done * sizeof(JournalRecord));
+        if (::pwrite(fd_, buf, padded, offset) !=
+            static_cast<ssize_t>(padded)) {
+            return false;
+        }
+        const auto* recs = reinterpret_cast<const JournalRecord*>(buf);
+        if (done == 0 && records > 0) {
+            header().first_trade_ns = recs[0].timestamp_ns;
+        }
+        if (records > 0) {
+            header().last_trade_ns = recs[records - 1].timestamp_ns;
+        }
+        written_.store(done + records, std::memory_order_relaxed);
+        header().record_count = done + records;
+        return write_header();
+    }
+
+    void writer_loop() {
+        constexpr size_t PAGE_RECORDS = ALIGNMENT / sizeof(JournalRecord);
+        WaitStrategy wait(256, 64, 1'000'000); // journal can sleep up to 1 ms
+        int active = 0;
+        size_t filled = 0; // records staged in the active buffer
+        bool failed = false;
+
+        // Flush whole pages and carry the unaligned remainder over into
+        // the other buffer, which becomes the new fill target while the
+        // flushed one is free for the next swap.
+        auto flush_pages = [&]() {
+            const size_t rounded = filled & ~(PAGE_RECORDS - 1);
+            if (rounded == 0 || failed) return;
+            char* full = buffers_[active];
+            const size_t remainder = filled - rounded;
+            if (remainder > 0) {
+                std::memcpy(buffers_[active ^ 1],
+                            full + rounded * sizeof(JournalRecord),
+                            remainder * sizeof(JournalRecord));
+            }
+            active ^= 1;
+            filled = remainder;
+            if (!write_records(full, rounded)) {
+                std::fprintf(stderr, "Journal %s stopped growing; journaling "
+                                     "disabled\n", path_.c_str());
+                failed = true;
+            }
+        };
+
+        for (;;) {
+            JournalRecord* dst =
+                reinterpret_cast<JournalRecord*>(buffers_[active]) + filled;
+            const size_t n = ring_.tryPopN(dst, CHUNK_RECORDS - filled);
+            if (n > 0) {
+                filled += n;
+                if (filled == CHUNK_RECORDS) {
+                    flush_pages();
+                }
+                wait.reset();
+                continue;
+            }
+            if (!running_.load(std::memory_order_acquire)) {
+                break;
+            }
+            // Quiet feed: flush staged pages before sleeping so a crash
+            // loses at most one page plus the in-flight ring contents.
+            if (filled >= PAGE_RECORDS && !wait.spinning()) {
+                flush_pages();
+            }
+            wait.idle();
+        }
+        flush_pages();
+        if (filled > 0 && !failed) {
+            (void)write_records(buffers_[active], filled);
+        }
+    }
+
+    void close_fd_and_buffers() {
+        if (fd_ >= 0 && header_block_) {
+            // Trim the alignment padding off the tail.
+            (void)::ftruncate(fd_, static_cast<off_t>(
+                QF_JOURNAL_HEADER_SIZE +
+                written_.load(std::memory_order_relaxed) *
+                    sizeof(JournalRecord)));
+        }
+        for (int i = 0; i < 2; ++i) {
+            std::free(buffers_[i]);
+            buffers_[i] = nullptr;
+        }
+        std::free(header_block_);
+        header_block_ = nullptr;
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    engine::memory::fast::LockFreeRingBuffer<JournalRecord, RING_CAPACITY> ring_;
+    std::thread writer_;
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> written_{0}; // stored by the writer thread
+
+    int fd_ = -1;
+    char* buffers_[2] = {nullptr, nullptr};
+    char* header_block_ = nullptr;
+    std::string path_;
+};
+
+/// Read-only view of a journal: one mmap of the whole file, records
+/// indexed as a flat array — the same access pattern the capture/replay
+/// tooling uses, so post-trade analysis never re-parses anything.
+class TradeJournalReader {
+public:
+    TradeJournalReader() = default;
+
+    ~TradeJournalReader() { close(); }
+
+    TradeJournalReader(const TradeJournalReader&) = delete;
+    TradeJournalReader& operator=(const TradeJournalReader&) = delete;
+
+    bool open(const std::string& path) {
+        if (base_) return true;
+
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            std::fprintf(stderr, "Failed to open journal %s: %s\n",
+                         path.c_str(), std::strerror(errno));
+            return false;
+        }
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 ||
+            static_cast<size_t>(st.st_size) < QF_JOURNAL_HEADER_SIZE) {
+            std::fprintf(stderr, "Journal %s is truncated\n", path.c_str());
+            ::close(fd);
+            return false;
+        }
+        mapped_size_ = static_cast<size_t>(st.st_size);
+
+        void* base = ::mmap(nullptr, mapped_size_, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            std::fprintf(stderr, "Failed to map journal %s: %s\n",
+                         path.c_str(), std::strerror(errno));
+            mapped_size_ = 0;
+            return false;
+        }
+
+        const auto* header = static_cast<const JournalFileHeader*>(base);
+        if (header->magic != QF_JOURNAL_MAGIC ||
+            header->version != QF_JOURNAL_VERSION) {
+            std::fprintf(stderr, "Journal %s: bad magic/version\n", path.c_str());
+            ::munmap(base, mapped_size_);
+            mapped_size_ = 0;
+            return false;
+        }
+
+        // A crash mid-write can leave record_count ahead of the data
+        // actually flushed; clamp to what the file really holds.
+        const uint64_t on_disk =
+            (mapped_size_ - QF_JOURNAL_HEADER_SIZE) / sizeof(JournalRecord);
+        base_ = base;
+        count_ = header->record_count < on_disk ? header->record_count : on_disk;
+        return true;
+    }
+
+    bool is_open() const { return base_ != nullptr; }
+    uint64_t size() const { return count_; }
+
+    const JournalRecord* records() const {
+        return reinterpret_cast<const JournalRecord*>(
+            static_cast<const char*>(base_) + QF_JOURNAL_HEADER_SIZE);
+    }
+
+    const JournalRecord& at(uint64_t i) const { return records()[i]; }
+
+    void close() {
+        if (base_) {
+            ::munmap(const_cast<void*>(base_), mapped_size_);
+            base_ = nullptr;
+        }
+        mapped_size_ = 0;
+        count_ = 0;
+    }
+
+private:
+    const void* base_ = nullptr;
+    size_t mapped_size_ = 0;
+    uint64_t count_ = 0;
+};
+
+} // namespace quantumflow
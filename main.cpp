@@ -1,3 +1,4 @@
+#include <array>
 #include <cstdio>
 #include <cstring>
 #include <chrono>
@@ -7,6 +8,7 @@
 #include <vector>
 #include <sstream>
 #include <cstdlib>
+#include <thread>
 #include <cerrno>
 #include <ctime>
 
@@ -18,9 +20,17 @@
 #include "LOB/Book.h"
 #include "common/price_converter.hpp"
 #include "common/market_data_packet.hpp"
+#include "common/symbol_table.hpp"
+#include "bridge/packet_capture.hpp"
 #include "bridge/shared_memory.hpp"
+#include "bridge/shm_bridge.hpp"
+#include "engine/sharded_engine.hpp"
+#include "ingest/native_ingest.hpp"
+#include "journal/book_image.hpp"
+#include "journal/trade_journal.hpp"
 #include "strategies/strategy_base.hpp"
 #include "strategies/strategy_engine.hpp"
+#include "strategies/static_strategy_engine.hpp"
 #include "strategies/microstructure/order_book_imbalance.hpp"
 #include "strategies/microstructure/market_maker.hpp"
 #include "strategies/microstructure/vwap_executor.hpp"
@@ -32,10 +42,17 @@
 #ifndef QUANTUMFLOW_HEADLESS
 #include "ws/ws_server.hpp"
 #include "ws/json_serializer.hpp"
+#include "ws/binary_serializer.hpp"
+#include "ws/payload_pool.hpp"
 #include "common/latency_snapshot.hpp"
+#include <mutex>
 #include <nlohmann/json.hpp>
 #endif
 
+#include "common/latency_histogram.hpp"
+#include "common/level_coalescer.hpp"
+#include "common/wait_strategy.hpp"
+
 using Clock = std::chrono::steady_clock;
 
 static uint64_t now_ns() {
@@ -46,14 +63,82 @@ static double ns_to_us(uint64_t ns) {
     return static_cast<double>(ns) / 1000.0;
 }
 
+// CLOCK_REALTIME in ns, the domain SO_TIMESTAMPNS kernel receive stamps
+// arrive in. Only the sampled stage-trace path pays for this syscall; the
+// hot path stays on steady_clock.
+static uint64_t wall_now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1'000'000'000ULL +
+           static_cast<uint64_t>(ts.tv_nsec);
+}
+
+// Kernel receive stamp from the SO_TIMESTAMPNS ancillary data attached to
+// a bridge-socket datagram, in CLOCK_REALTIME ns; 0 when the control
+// buffer carries no stamp.
+static uint64_t cmsg_kernel_rx_ns(msghdr& hdr) {
+    for (cmsghdr* c = CMSG_FIRSTHDR(&hdr); c != nullptr; c = CMSG_NXTHDR(&hdr, c)) {
+        if (c->cmsg_level == SOL_SOCKET && c->cmsg_type == SCM_TIMESTAMPNS) {
+            struct timespec ts;
+            std::memcpy(&ts, CMSG_DATA(c), sizeof(ts));
+            return static_cast<uint64_t>(ts.tv_sec) * 1'000'000'000ULL +
+                   static_cast<uint64_t>(ts.tv_nsec);
+        }
+    }
+    return 0;
+}
+
 struct Config {
     std::vector<std::string> symbols;
     bool headless = false;
     int ws_port = 9001;
     std::string bridge_socket_path = "/tmp/quantumflow_bridge.sock";
     std::string pipeline_control_socket_path = "/tmp/quantumflow_pipeline_ctrl.sock";
+    std::string shm_ring_name = QF_SHM_RING_DEFAULT_NAME;
+    int shm_producers = 1; // one shared-memory ring per ingest process
+    int shards = 0; // 0 = single-threaded processing on the main loop
+    std::string capture_path;   // record drained packets to this file
+    std::string replay_path;    // replay a capture through the bridge
+    std::string journal_path;   // append executed trades to this journal
+    bool journal_direct = false; // open the journal O_DIRECT
+    std::string warm_start_dir; // restore + persist per-symbol book images
+    bool replay_paced = false;  // reproduce recorded gaps vs. full speed
+    int consumer_core = -1;     // pin the drain loop thread (-1 = unpinned)
+    int ws_core = -1;           // pin the WsServer event-loop thread
+    int spin_budget = 4096;     // pause-spin iterations before yielding
+    int max_sleep_us = 100;     // backoff ceiling once genuinely quiet
+    std::vector<std::string> native_symbols; // symbols ingested natively,
+                                             // bypassing the Python pipeline
+    std::string native_url = "ws://ws.okx.com:8443/ws/v5/public";
+    int native_core = -1;       // pin the native ingest thread
 };
 
+/// Compile-time strategy set run by the main loop: all dispatch is static,
+/// so per-tick evaluate/confidence calls inline instead of going through
+/// the vtable.
+using MainStrategyEngine = quantumflow::StaticStrategyEngine<
+    quantumflow::OrderBookImbalance,
+    quantumflow::MarketMaker,
+    quantumflow::VWAPExecutor,
+    quantumflow::LiquidityDetector,
+    quantumflow::FundingArbitrage,
+    quantumflow::MomentumStrategy,
+    quantumflow::PairsTrading>;
+
+/// Same strategies on a dynamic engine; used for the per-shard engines in
+/// sharded mode (and for plugin-style registration).
+static std::unique_ptr<quantumflow::StrategyEngine> make_strategy_engine() {
+    auto engine = std::make_unique<quantumflow::StrategyEngine>();
+    engine->add_strategy(std::make_unique<quantumflow::OrderBookImbalance>());
+    engine->add_strategy(std::make_unique<quantumflow::MarketMaker>());
+    engine->add_strategy(std::make_unique<quantumflow::VWAPExecutor>());
+    engine->add_strategy(std::make_unique<quantumflow::LiquidityDetector>());
+    engine->add_strategy(std::make_unique<quantumflow::FundingArbitrage>());
+    engine->add_strategy(std::make_unique<quantumflow::MomentumStrategy>());
+    engine->add_strategy(std::make_unique<quantumflow::PairsTrading>());
+    return engine;
+}
+
 static Config parse_args(int argc, char* argv[]) {
     Config cfg;
     cfg.symbols = {"BTC-USDT-SWAP", "ETH-USDT-SWAP"};
@@ -74,6 +159,46 @@ static Config parse_args(int argc, char* argv[]) {
             cfg.bridge_socket_path = argv[++i];
         } else if (std::strcmp(argv[i], "--pipeline-control-socket") == 0 && i + 1 < argc) {
             cfg.pipeline_control_socket_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--shm-ring") == 0 && i + 1 < argc) {
+            cfg.shm_ring_name = argv[++i];
+        } else if (std::strcmp(argv[i], "--shm-producers") == 0 && i + 1 < argc) {
+            cfg.shm_producers = std::atoi(argv[++i]);
+            if (cfg.shm_producers < 1) cfg.shm_producers = 1;
+        } else if (std::strcmp(argv[i], "--shards") == 0 && i + 1 < argc) {
+            cfg.shards = std::atoi(argv[++i]);
+            if (cfg.shards < 0) cfg.shards = 0;
+        } else if (std::strcmp(argv[i], "--capture") == 0 && i + 1 < argc) {
+            cfg.capture_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            cfg.replay_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--replay-paced") == 0) {
+            cfg.replay_paced = true;
+        } else if (std::strcmp(argv[i], "--journal") == 0 && i + 1 < argc) {
+            cfg.journal_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--journal-direct") == 0) {
+            cfg.journal_direct = true;
+        } else if (std::strcmp(argv[i], "--warm-start") == 0 && i + 1 < argc) {
+            cfg.warm_start_dir = argv[++i];
+        } else if (std::strcmp(argv[i], "--consumer-core") == 0 && i + 1 < argc) {
+            cfg.consumer_core = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--ws-core") == 0 && i + 1 < argc) {
+            cfg.ws_core = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--spin-budget") == 0 && i + 1 < argc) {
+            cfg.spin_budget = std::atoi(argv[++i]);
+            if (cfg.spin_budget < 0) cfg.spin_budget = 0;
+        } else if (std::strcmp(argv[i], "--max-sleep-us") == 0 && i + 1 < argc) {
+            cfg.max_sleep_us = std::atoi(argv[++i]);
+            if (cfg.max_sleep_us < 1) cfg.max_sleep_us = 1;
+        } else if (std::strcmp(argv[i], "--native-symbols") == 0 && i + 1 < argc) {
+            std::istringstream ss(argv[++i]);
+            std::string token;
+            while (std::getline(ss, token, ',')) {
+                if (!token.empty()) cfg.native_symbols.push_back(token);
+            }
+        } else if (std::strcmp(argv[i], "--native-url") == 0 && i + 1 < argc) {
+            cfg.native_url = argv[++i];
+        } else if (std::strcmp(argv[i], "--native-core") == 0 && i + 1 < argc) {
+            cfg.native_core = std::atoi(argv[++i]);
         }
     }
     return cfg;
@@ -96,6 +221,14 @@ static int open_bridge_socket(const std::string& path) {
         (void)::fcntl(fd, F_SETFL, flags | O_NONBLOCK);
     }
 
+    // Kernel receive stamps for the sampled stage trace; best effort — the
+    // trace just records nothing for the kernel hop if this is denied.
+    int on = 1;
+    if (::setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on)) != 0) {
+        std::fprintf(stderr, "SO_TIMESTAMPNS unavailable on bridge socket: %s\n",
+                     std::strerror(errno));
+    }
+
     (void)::unlink(path.c_str());
 
     sockaddr_un addr{};
@@ -168,45 +301,238 @@ int main(int argc, char* argv[]) {
 
     quantumflow::PriceConverterRegistry price_reg(100.0);
 
-    std::unordered_map<std::string, std::unique_ptr<Book>> books;
+    // Per-symbol state lives in a flat array indexed by SymbolId so the
+    // packet hot path never hashes strings or allocates.
+    quantumflow::SymbolTable symbol_table;
+
+    struct SymbolState {
+        std::unique_ptr<Book> book;
+        quantumflow::TradeRing<1024> recent_trades;
+        quantumflow::BookSnapshot snapshot; // cached; patched incrementally
+        bool snapshot_valid = false;
+        // Change gate for lazy evaluation: evaluation is skipped when the
+        // book version and trade sequence match the last evaluated tick.
+        uint64_t trade_seq = 0;
+        uint64_t last_eval_book_version = 0;
+        uint64_t last_eval_trade_seq = 0;
+        uint64_t last_image_version = 0; // book version at last image write
+#ifndef QUANTUMFLOW_HEADLESS
+        quantumflow::TradeRing<256> ws_trades;
+#endif
+    };
+    std::vector<SymbolState> symbol_states;
+
+    // Rebuild the cached snapshot once, then patch it from dirty levels.
+    auto sync_snapshot = [&](quantumflow::SymbolId id, SymbolState& st) -> quantumflow::BookSnapshot& {
+        if (!st.snapshot_valid) {
+            st.snapshot = quantumflow::BookSnapshot::from_book(
+                *st.book, symbol_table.name(id), price_reg.get(id));
+            st.snapshot_valid = true;
+        } else {
+            st.snapshot.update_from_book(*st.book, price_reg.get(id));
+        }
+        return st.snapshot;
+    };
+
+    auto state_for = [&](quantumflow::SymbolId id) -> SymbolState& {
+        if (id >= symbol_states.size()) {
+            symbol_states.resize(id + 1);
+        }
+        auto& st = symbol_states[id];
+        if (!st.book) {
+            st.book = std::make_unique<Book>();
+        }
+        return st;
+    };
+
     for (const auto& sym : cfg.symbols) {
-        books[sym] = std::make_unique<Book>();
+        (void)state_for(symbol_table.intern(sym));
     }
 
-    quantumflow::StrategyEngine strategy_engine;
-    strategy_engine.add_strategy(std::make_unique<quantumflow::OrderBookImbalance>());
-    strategy_engine.add_strategy(std::make_unique<quantumflow::MarketMaker>());
-    strategy_engine.add_strategy(std::make_unique<quantumflow::VWAPExecutor>());
-    strategy_engine.add_strategy(std::make_unique<quantumflow::LiquidityDetector>());
-    strategy_engine.add_strategy(std::make_unique<quantumflow::FundingArbitrage>());
-    strategy_engine.add_strategy(std::make_unique<quantumflow::MomentumStrategy>());
-    strategy_engine.add_strategy(std::make_unique<quantumflow::PairsTrading>());
+    MainStrategyEngine strategy_engine;
+
+    std::unique_ptr<quantumflow::ShardedEngine> sharded_engine;
+    if (cfg.shards > 0) {
+        sharded_engine = std::make_unique<quantumflow::ShardedEngine>(
+            static_cast<size_t>(cfg.shards), make_strategy_engine);
+        sharded_engine->start();
+        std::printf("Sharded mode: %zu workers\n", sharded_engine->shard_count());
+    }
 
     auto& bridge = quantumflow::global_bridge();
     int bridge_socket_fd = open_bridge_socket(cfg.bridge_socket_path);
     uint64_t bridge_socket_rx = 0;
     uint64_t bridge_socket_bad = 0;
 
-    std::unordered_map<std::string, std::vector<quantumflow::TradeInfo>> recent_trades;
-    for (const auto& sym : cfg.symbols)
-        recent_trades[sym] = {};
+    quantumflow::ShmBridgeFanIn shm_bridge;
+    if (shm_bridge.create_and_init(cfg.shm_ring_name,
+                                   static_cast<size_t>(cfg.shm_producers))) {
+        std::printf("Shm Ring: %s x%zu (%u packets each)\n",
+                    cfg.shm_ring_name.c_str(), shm_bridge.ring_count(),
+                    QF_SHM_RING_DEFAULT_CAPACITY);
+    } else {
+        std::fprintf(stderr, "Shm ring unavailable; relying on UDS ingress only\n");
+    }
+
+    // Native ingest: latency-critical symbols skip the Python pipeline
+    // entirely — a C++ WebSocket client parses the exchange JSON and
+    // pushes packets into the in-process bridge. Other symbols keep
+    // flowing through the Python path unchanged.
+    std::unique_ptr<quantumflow::NativeIngest> native_ingest;
+    if (!cfg.native_symbols.empty()) {
+        quantumflow::NativeIngestConfig ingest_cfg;
+        ingest_cfg.url = cfg.native_url;
+        ingest_cfg.symbols = cfg.native_symbols;
+        ingest_cfg.core = cfg.native_core;
+        native_ingest = std::make_unique<quantumflow::NativeIngest>(ingest_cfg);
+        if (native_ingest->start()) {
+            std::printf("Native ingest: %zu symbols via %s\n",
+                        cfg.native_symbols.size(), cfg.native_url.c_str());
+            for (const auto& sym : cfg.native_symbols) {
+                (void)state_for(symbol_table.intern(sym));
+            }
+        } else {
+            std::fprintf(stderr, "Native ingest unavailable; symbols stay on "
+                                 "the Python pipeline\n");
+            native_ingest.reset();
+        }
+    }
 
-    uint64_t next_order_id = 1;
+    // Warm start: replay the last persisted book image for every symbol
+    // through set_level before the first packet is processed, so a restart
+    // resumes with populated books instead of waiting for the feed to
+    // rebuild depth. The same directory receives the periodic images.
+    if (!cfg.warm_start_dir.empty()) {
+        size_t restored_levels = 0;
+        size_t restored_books = 0;
+        for (quantumflow::SymbolId id = 0; id < symbol_states.size(); ++id) {
+            SymbolState& st = symbol_states[id];
+            if (!st.book) continue;
+            const std::string path = quantumflow::book_image_path(
+                cfg.warm_start_dir, symbol_table.name(id));
+            const size_t n = quantumflow::restore_book_image(*st.book, path);
+            if (n > 0) {
+                restored_levels += n;
+                ++restored_books;
+                st.last_image_version = st.book->version();
+            }
+        }
+        std::printf("Warm start: %zu levels across %zu books from %s\n",
+                    restored_levels, restored_books, cfg.warm_start_dir.c_str());
+    }
+
+    // Capture: every packet the drain path processes is appended to a
+    // memory-mapped file together with its ingest timestamp, so production
+    // incidents can be replayed deterministically.
+    quantumflow::PacketCaptureWriter capture;
+    if (!cfg.capture_path.empty()) {
+        if (capture.open(cfg.capture_path)) {
+            std::printf("Capture: recording to %s\n", cfg.capture_path.c_str());
+        } else {
+            std::fprintf(stderr, "Capture disabled; continuing without it\n");
+        }
+    }
+
+    // Journal: every executed trade is staged onto a lock-free ring and a
+    // dedicated writer thread appends it to a binary file, so trade history
+    // survives restarts without growing in-memory vectors and without the
+    // matching thread ever blocking on disk.
+    quantumflow::TradeJournalWriter journal;
+    if (!cfg.journal_path.empty()) {
+        if (journal.open(cfg.journal_path, cfg.journal_direct)) {
+            std::printf("Journal: recording trades to %s%s\n",
+                        cfg.journal_path.c_str(),
+                        cfg.journal_direct ? " (O_DIRECT)" : "");
+        } else {
+            std::fprintf(stderr, "Journal disabled; continuing without it\n");
+        }
+    }
+
+    // Replay: mmap a capture and push its packets through the in-process
+    // bridge from a dedicated thread, either reproducing the recorded
+    // inter-packet gaps (--replay-paced) or as fast as the ring accepts
+    // them. Backpressure blocks the replayer instead of dropping, so runs
+    // are deterministic.
+    quantumflow::PacketCaptureReader replay;
+    std::thread replay_thread;
+    if (!cfg.replay_path.empty()) {
+        if (!replay.open(cfg.replay_path)) {
+            return 1;
+        }
+        std::printf("Replay: %s (%lu packets, %s)\n", cfg.replay_path.c_str(),
+                    replay.size(), cfg.replay_paced ? "paced" : "full speed");
+        replay_thread = std::thread([&bridge, &replay, paced = cfg.replay_paced] {
+            const quantumflow::CaptureRecord* recs = replay.records();
+            const uint64_t n = replay.size();
+            const uint64_t start_ns = now_ns();
+            const uint64_t first_ingest = n > 0 ? recs[0].ingest_ns : 0;
+            for (uint64_t i = 0; i < n; ++i) {
+                if (paced) {
+                    const uint64_t target =
+                        start_ns + (recs[i].ingest_ns - first_ingest);
+                    while (now_ns() < target) {
+                        struct timespec ts = {0, 10000}; // 10us
+                        nanosleep(&ts, nullptr);
+                    }
+                }
+                while (!bridge.push(recs[i].packet)) {
+                    struct timespec ts = {0, 10000}; // ring full: wait, don't drop
+                    nanosleep(&ts, nullptr);
+                }
+            }
+            const uint64_t elapsed = now_ns() - start_ns;
+            std::printf("Replay finished: %lu packets in %.3f s (%.0f pkt/s)\n",
+                        n, static_cast<double>(elapsed) / 1e9,
+                        elapsed > 0 ? static_cast<double>(n) * 1e9 /
+                                          static_cast<double>(elapsed)
+                                    : 0.0);
+        });
+    }
 
 #ifndef QUANTUMFLOW_HEADLESS
     quantumflow::WsServer ws_server;
-    std::unordered_map<std::string, std::vector<quantumflow::TradeInfo>> ws_trade_buffers;
-    for (const auto& sym : cfg.symbols) {
-        ws_trade_buffers[sym] = {};
-    }
     uint64_t last_broadcast_ns = 0;
     constexpr uint64_t BROADCAST_INTERVAL_NS = 33'333'333; // ~30 Hz
 
+    // Per-symbol JSON book stream state: a full snapshot seeds the stream
+    // (and answers resync requests), then each tick publishes a delta with
+    // a running sequence number so clients can detect gaps.
+    struct WsBookStream {
+        uint64_t seq = 0;
+        quantumflow::BookSnapshot last;
+        bool need_full = true;
+    };
+    std::unordered_map<std::string, WsBookStream> ws_book_streams;
+    std::mutex ws_resync_mutex;
+    std::vector<std::string> ws_resync_requests; // filled on the WS thread
+    std::mutex ws_history_mutex;
+    std::vector<std::string> ws_history_requests; // strategy names, WS thread
+
     if (!cfg.headless) {
-        ws_server.set_message_handler([&cfg](const std::string& raw_msg) {
+        ws_server.set_message_handler([&cfg, &ws_resync_mutex,
+                                       &ws_resync_requests, &ws_history_mutex,
+                                       &ws_history_requests](const std::string& raw_msg) {
             try {
                 auto msg = nlohmann::json::parse(raw_msg);
-                if (!msg.is_object() || msg.value("type", "") != "set_symbols") {
+                if (!msg.is_object()) {
+                    return;
+                }
+                const std::string type = msg.value("type", "");
+                if (type == "strategy_history") {
+                    // On-demand transition history: the next broadcast tick
+                    // answers with one strategy_history frame per name.
+                    const auto names_json = msg.find("strategies");
+                    if (names_json == msg.end() || !names_json->is_array()) {
+                        return;
+                    }
+                    std::lock_guard<std::mutex> lock(ws_history_mutex);
+                    for (const auto& item : *names_json) {
+                        if (!item.is_string()) continue;
+                        std::string name = item.get<std::string>();
+                        if (!name.empty()) {
+                            ws_history_requests.push_back(std::move(name));
+                        }
+                    }
                     return;
                 }
                 const auto symbols_json = msg.find("symbols");
@@ -223,134 +549,371 @@ int main(int argc, char* argv[]) {
                 if (symbols.empty()) {
                     return;
                 }
+                if (type == "resync") {
+                    // Client saw a sequence gap (or just subscribed): next
+                    // broadcast tick re-sends full snapshots for these symbols.
+                    std::lock_guard<std::mutex> lock(ws_resync_mutex);
+                    ws_resync_requests.insert(ws_resync_requests.end(),
+                                              symbols.begin(), symbols.end());
+                    return;
+                }
+                if (type != "set_symbols") {
+                    return;
+                }
                 (void)send_pipeline_symbol_update(cfg.pipeline_control_socket_path, symbols);
             } catch (...) {
             }
         });
-        if (!ws_server.init(cfg.ws_port)) {
+        if (!ws_server.init(cfg.ws_port, cfg.ws_core)) {
             std::fprintf(stderr, "Failed to init WebSocket server, falling back to headless\n");
             cfg.headless = true;
         }
     }
 #endif
 
+    // Dedicating a core to the drain loop plus a bounded spin budget gets
+    // single-digit-microsecond wakeup on the first packet after a lull.
+    if (quantumflow::pin_current_thread(cfg.consumer_core)) {
+        std::printf("Consumer pinned to core %d\n", cfg.consumer_core);
+    }
+    quantumflow::WaitStrategy idle_wait(
+        static_cast<uint32_t>(cfg.spin_budget), 64,
+        static_cast<uint64_t>(cfg.max_sleep_us) * 1000);
+
     std::printf("Entering main loop. Waiting for market data on bridge ingress...\n");
 
+    constexpr int MAX_DRAIN_PER_FRAME = 256;
+
+    // Batched UDS ingress: one recvmmsg() call pulls up to a full frame's
+    // worth of packets instead of one recv() syscall per packet.
+    std::vector<quantumflow::MarketDataPacket> uds_batch(MAX_DRAIN_PER_FRAME);
+    std::vector<quantumflow::MarketDataPacket> bridge_batch(MAX_DRAIN_PER_FRAME);
+    std::vector<iovec> uds_iovs(MAX_DRAIN_PER_FRAME);
+    std::vector<mmsghdr> uds_msgs(MAX_DRAIN_PER_FRAME);
+    std::vector<std::array<char, CMSG_SPACE(sizeof(timespec))>> uds_ctrl(
+        MAX_DRAIN_PER_FRAME);
+    for (int i = 0; i < MAX_DRAIN_PER_FRAME; ++i) {
+        uds_iovs[i].iov_base = &uds_batch[i];
+        uds_iovs[i].iov_len = sizeof(quantumflow::MarketDataPacket);
+        uds_msgs[i] = {};
+        uds_msgs[i].msg_hdr.msg_iov = &uds_iovs[i];
+        uds_msgs[i].msg_hdr.msg_iovlen = 1;
+        uds_msgs[i].msg_hdr.msg_control = uds_ctrl[i].data();
+        uds_msgs[i].msg_hdr.msg_controllen = uds_ctrl[i].size();
+    }
+
+    // Stage latency histograms; merged stats are broadcast with the
+    // latency message and the window resets every few seconds.
+    quantumflow::LatencyHistogramSet latency_hist;
+    constexpr uint64_t HIST_RESET_INTERVAL_NS = 5'000'000'000; // 5 s windows
+    uint64_t last_hist_reset_ns = now_ns();
+
+    constexpr uint64_t POOL_RECLAIM_INTERVAL_NS = 30'000'000'000; // 30 s
+    uint64_t last_pool_reclaim_ns = now_ns();
+
+    constexpr uint64_t BOOK_IMAGE_INTERVAL_NS = 5'000'000'000; // 5 s
+    uint64_t last_book_image_ns = now_ns();
+
     uint64_t loop_count = 0;
     bool running = true;
-    std::string active_symbol = cfg.symbols.empty() ? "" : cfg.symbols[0];
+    quantumflow::SymbolId active_id = cfg.symbols.empty()
+        ? quantumflow::INVALID_SYMBOL_ID
+        : symbol_table.intern(cfg.symbols[0]);
+    quantumflow::SymbolId last_evaluated_id = quantumflow::INVALID_SYMBOL_ID;
     double latest_python_to_cpp_us = 0.0;
 
+    // Coalescing stage between the bridge drain and the book: during depth
+    // bursts, 30-50% of packets are same-price overwrites where only the
+    // last quantity matters. Level updates stage into the table and the
+    // survivors are applied once per frame; any other event type flushes
+    // first so relative ordering against book mutations is preserved.
+    quantumflow::LevelCoalescer level_coalescer;
+
+    // Feed-integrity mismatches detected via EVENT_BOOK_CHECKSUM; each one
+    // triggered a single-symbol resync rather than a blanket resubscribe.
+    uint64_t checksum_mismatches = 0;
+
+    // Stage trace: 1-in-N packets on the UDS ingress get per-hop stamps —
+    // sender (timestamp_ns), kernel receive (SO_TIMESTAMPNS), drain, and
+    // end-of-frame matching — so a tail regression in python_to_cpp can be
+    // pinned to the hop that actually moved. The frame-level order_match /
+    // strategy_eval histograms already cover the stages past matching.
+    constexpr uint64_t STAGE_TRACE_SAMPLE = 128;
+    bool stage_trace_armed = false;
+    uint64_t stage_trace_drain_ns = 0;
+
     while (running) {
         uint64_t loop_start = now_ns();
 
         int drained = 0;
-        constexpr int MAX_DRAIN_PER_FRAME = 256;
+
+        auto apply_staged_level = [&](quantumflow::SymbolId id, uint8_t side,
+                                      uint64_t price, uint64_t quantity) {
+            SymbolState& st = state_for(id);
+            OrderType ot = (side == 0) ? BUY : SELL;
+            st.book->set_level(ot, static_cast<PRICE>(price), quantity);
+        };
 
         auto process_packet = [&](const quantumflow::MarketDataPacket& pkt) {
-            char symbol_buf[sizeof(pkt.symbol) + 1]{};
-            std::memcpy(symbol_buf, pkt.symbol, sizeof(pkt.symbol));
-            std::string sym(symbol_buf);
-            if (sym.empty()) {
+            if (capture.is_open()) {
+                capture.record(pkt, now_ns());
+            }
+            if (pkt.event_type == quantumflow::EVENT_SYMBOL_CONFIG) {
+                // Session-start scale negotiation: price carries the
+                // per-symbol price scale. Applied by the registry owner in
+                // both modes; senders emit it before any data flows.
+                quantumflow::SymbolId cfg_id = symbol_table.intern(pkt.symbol);
+                if (cfg_id != quantumflow::INVALID_SYMBOL_ID && pkt.price > 0) {
+                    price_reg.set_scale(cfg_id, static_cast<double>(pkt.price));
+                }
+                // Shards assign their own symbol ids, so the owning shard
+                // must record the scale under its local id too.
+                if (sharded_engine) {
+                    (void)sharded_engine->submit(pkt);
+                }
+                return;
+            }
+            if (sharded_engine) {
+                uint64_t shard_ingest_ns = now_ns();
+                if (pkt.timestamp_ns > 0 && shard_ingest_ns >= pkt.timestamp_ns) {
+                    latest_python_to_cpp_us = ns_to_us(shard_ingest_ns - pkt.timestamp_ns);
+                    latency_hist.python_to_cpp.record_ns(shard_ingest_ns - pkt.timestamp_ns);
+                }
+                (void)sharded_engine->submit(pkt);
                 return;
             }
 
-            active_symbol = sym;
-
-            auto it = books.find(sym);
-            if (it == books.end()) {
-                books[sym] = std::make_unique<Book>();
-                recent_trades[sym] = {};
-#ifndef QUANTUMFLOW_HEADLESS
-                ws_trade_buffers[sym] = {};
-#endif
-                it = books.find(sym);
+            quantumflow::SymbolId id = symbol_table.intern(pkt.symbol);
+            if (id == quantumflow::INVALID_SYMBOL_ID) {
+                return;
             }
 
+            active_id = id;
+            SymbolState& st = state_for(id);
+
             uint64_t ingest_ns = now_ns();
             if (pkt.timestamp_ns > 0 && ingest_ns >= pkt.timestamp_ns) {
                 latest_python_to_cpp_us = ns_to_us(ingest_ns - pkt.timestamp_ns);
+                latency_hist.python_to_cpp.record_ns(ingest_ns - pkt.timestamp_ns);
             }
 
-            const auto& converter = price_reg.get(sym);
+            const auto& converter = price_reg.get(id);
 
-            if (pkt.event_type == 0) {
-                OrderType ot = (pkt.side == 0) ? BUY : SELL;
-                PRICE internal_price = converter.to_internal(pkt.price);
-                const Trades& trades = it->second->place_order(
-                    next_order_id++, 0, ot, internal_price, pkt.quantity);
-
-                for (const auto& t : trades) {
-                    quantumflow::TradeInfo ti{
-                        converter.to_external(t.get_trade_price()),
-                        t.get_trade_volume(),
-                        pkt.side,
-                        pkt.timestamp_ns
-                    };
-                    recent_trades[sym].push_back(ti);
-                    strategy_engine.on_trade(ti);
-#ifndef QUANTUMFLOW_HEADLESS
-                    if (!cfg.headless) ws_trade_buffers[sym].push_back(ti);
-#endif
+            if (pkt.event_type == quantumflow::EVENT_BOOK_LEVEL) {
+                // L2 depth update: staged in the coalescer so same-price
+                // overwrites within this frame fold to the last value; the
+                // survivors reach set_level at flush. Trades arrive as
+                // event_type 1. Wire prices are pre-scaled ticks.
+                if (!level_coalescer.stage(id, pkt.side, pkt.price, pkt.quantity)) {
+                    level_coalescer.flush(apply_staged_level);
+                    (void)level_coalescer.stage(id, pkt.side, pkt.price, pkt.quantity);
                 }
-            } else if (pkt.event_type == 1) {
-                quantumflow::TradeInfo ti{pkt.price, pkt.quantity, pkt.side, pkt.timestamp_ns};
-                recent_trades[sym].push_back(ti);
+                return;
+            }
+
+            // Any non-level event: apply staged levels first so book
+            // mutations keep their order relative to the staged updates.
+            if (!level_coalescer.empty()) {
+                level_coalescer.flush(apply_staged_level);
+            }
+
+            if (pkt.event_type == quantumflow::EVENT_TRADE) {
+                quantumflow::TradeInfo ti{
+                    converter.to_external(static_cast<PRICE>(pkt.price)),
+                    pkt.quantity, pkt.side, pkt.timestamp_ns};
+                st.recent_trades.push(ti);
+                st.trade_seq++;
                 strategy_engine.on_trade(ti);
+                if (journal.is_open()) {
+                    (void)journal.append({st.trade_seq, ti.timestamp_ns,
+                                          ti.price, ti.quantity, id, ti.side,
+                                          {}});
+                }
+#ifndef QUANTUMFLOW_HEADLESS
+                if (!cfg.headless) st.ws_trades.push(ti);
+#endif
+            } else if (pkt.event_type == quantumflow::EVENT_ORDER_ADD) {
+                OrderType ot = (pkt.side == 0) ? BUY : SELL;
+                PRICE internal_price = static_cast<PRICE>(pkt.price);
+                // Sink runs inside the matching loop: each fill is written
+                // once straight into its consumers, no intermediate buffer.
+                st.book->place_order(
+                    pkt.order_id, 0, ot, internal_price, pkt.quantity,
+                    [&](const Trade& t) {
+                        quantumflow::TradeInfo ti{
+                            converter.to_external(t.get_trade_price()),
+                            t.get_trade_volume(),
+                            pkt.side,
+                            pkt.timestamp_ns
+                        };
+                        st.recent_trades.push(ti);
+                        st.trade_seq++;
+                        strategy_engine.on_trade(ti);
+                        if (journal.is_open()) {
+                            (void)journal.append({st.trade_seq,
+                                                  ti.timestamp_ns, ti.price,
+                                                  ti.quantity, id, ti.side,
+                                                  {}});
+                        }
 #ifndef QUANTUMFLOW_HEADLESS
-                if (!cfg.headless) ws_trade_buffers[sym].push_back(ti);
+                        if (!cfg.headless) st.ws_trades.push(ti);
 #endif
+                    });
+            } else if (pkt.event_type == quantumflow::EVENT_ORDER_CANCEL) {
+                st.book->delete_order(pkt.order_id);
+            } else if (pkt.event_type == quantumflow::EVENT_ORDER_MODIFY) {
+                st.book->modify_order(pkt.order_id, pkt.quantity);
+            } else if (pkt.event_type == quantumflow::EVENT_BOOK_CHECKSUM) {
+                // Feed-integrity check: the producer checksummed the levels
+                // it just sent; the coalescer flushed above, so our book
+                // must agree. A mismatch means this symbol's book diverged
+                // (dropped or misapplied update) — rebuild it and ask the
+                // ingest for a fresh snapshot of just this symbol instead
+                // of a blanket resubscribe.
+                const size_t depth = pkt.quantity > 0
+                    ? static_cast<size_t>(pkt.quantity)
+                    : BookChecksum::DEPTH;
+                if (!st.book->verify(static_cast<uint32_t>(pkt.price), depth)) {
+                    ++checksum_mismatches;
+                    st.book = std::make_unique<Book>();
+                    st.snapshot_valid = false;
+                    st.last_image_version = 0;
+                    if (native_ingest) {
+                        native_ingest->resubscribe(pkt.symbol);
+                    }
+                    std::fprintf(stderr,
+                                 "Checksum mismatch on %s (depth %zu); "
+                                 "resyncing symbol\n",
+                                 pkt.symbol, depth);
+                }
             }
         };
 
         quantumflow::MarketDataPacket pkt{};
-        while (drained < MAX_DRAIN_PER_FRAME && bridge.pop(pkt)) {
+        while (drained < MAX_DRAIN_PER_FRAME && shm_bridge.pop(pkt)) {
             process_packet(pkt);
             drained++;
         }
 
+        // Drain the in-process bridge in batches: one ring index update
+        // covers the whole span instead of ping-ponging the head/tail
+        // cache lines once per packet.
+        while (drained < MAX_DRAIN_PER_FRAME) {
+            const size_t room = static_cast<size_t>(MAX_DRAIN_PER_FRAME - drained);
+            const size_t n = bridge.pop_batch(bridge_batch.data(), room);
+            if (n == 0) break;
+            for (size_t i = 0; i < n; ++i) {
+                process_packet(bridge_batch[i]);
+            }
+            drained += static_cast<int>(n);
+        }
+
         if (bridge_socket_fd >= 0) {
             while (drained < MAX_DRAIN_PER_FRAME) {
-                quantumflow::MarketDataPacket sock_pkt{};
-                ssize_t n = ::recv(bridge_socket_fd, &sock_pkt, sizeof(sock_pkt), 0);
+                int room = MAX_DRAIN_PER_FRAME - drained;
+                // The kernel shrinks msg_controllen to the stamp it wrote;
+                // restore full capacity before reusing the headers.
+                for (int i = 0; i < room; ++i) {
+                    uds_msgs[i].msg_hdr.msg_controllen = uds_ctrl[i].size();
+                }
+                int n = ::recvmmsg(bridge_socket_fd, uds_msgs.data(),
+                                   static_cast<unsigned int>(room), MSG_DONTWAIT, nullptr);
                 if (n < 0) {
                     if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
                         break;
                     }
-                    std::fprintf(stderr, "Bridge socket recv error: %s\n", std::strerror(errno));
+                    std::fprintf(stderr, "Bridge socket recvmmsg error: %s\n",
+                                 std::strerror(errno));
                     break;
                 }
-                if (static_cast<size_t>(n) != sizeof(sock_pkt)) {
-                    bridge_socket_bad++;
-                    continue;
+                for (int i = 0; i < n; ++i) {
+                    if (uds_msgs[i].msg_len !=
+                        sizeof(quantumflow::MarketDataPacket)) {
+                        bridge_socket_bad++;
+                        continue;
+                    }
+                    if ((bridge_socket_rx % STAGE_TRACE_SAMPLE) == 0 &&
+                        !stage_trace_armed) {
+                        // The kernel stamp is CLOCK_REALTIME; shift it into
+                        // the monotonic domain with an offset sampled right
+                        // here — drift over the microseconds since kernel
+                        // receive is noise next to the hops measured.
+                        const uint64_t kernel_real =
+                            cmsg_kernel_rx_ns(uds_msgs[i].msg_hdr);
+                        if (kernel_real > 0) {
+                            const uint64_t drain_ns = now_ns();
+                            const int64_t kernel_mono =
+                                static_cast<int64_t>(kernel_real) +
+                                static_cast<int64_t>(drain_ns) -
+                                static_cast<int64_t>(wall_now_ns());
+                            const uint64_t send_ns = uds_batch[i].timestamp_ns;
+                            if (send_ns > 0 &&
+                                kernel_mono >= static_cast<int64_t>(send_ns)) {
+                                latency_hist.send_to_kernel.record_ns(
+                                    static_cast<uint64_t>(kernel_mono) - send_ns);
+                            }
+                            if (kernel_mono > 0 &&
+                                static_cast<int64_t>(drain_ns) >= kernel_mono) {
+                                latency_hist.kernel_to_drain.record_ns(
+                                    drain_ns - static_cast<uint64_t>(kernel_mono));
+                            }
+                            stage_trace_armed = true;
+                            stage_trace_drain_ns = drain_ns;
+                        }
+                    }
+                    process_packet(uds_batch[i]);
+                    bridge_socket_rx++;
+                    drained++;
+                }
+                if (n < room) {
+                    break; // socket drained
                 }
-                process_packet(sock_pkt);
-                bridge_socket_rx++;
-                drained++;
             }
         }
 
+        // End of frame: apply the surviving level updates in one pass.
+        if (!level_coalescer.empty()) {
+            level_coalescer.flush(apply_staged_level);
+        }
+
         uint64_t strat_start = now_ns();
-        quantumflow::BookSnapshot snapshot;
-        if (!active_symbol.empty()) {
-            const auto& primary_sym = active_symbol;
-            auto bit = books.find(primary_sym);
-            if (bit != books.end()) {
-                snapshot = quantumflow::BookSnapshot::from_book(
-                    *bit->second, primary_sym, price_reg.get(primary_sym));
-                snapshot.timestamp_ns = now_ns();
+        if (!sharded_engine &&
+            active_id != quantumflow::INVALID_SYMBOL_ID &&
+            active_id < symbol_states.size() && symbol_states[active_id].book) {
+            SymbolState& st = symbol_states[active_id];
 
-                auto& trades_buf = recent_trades[primary_sym];
-                if (trades_buf.size() > 1000) {
-                    trades_buf.erase(trades_buf.begin(),
-                                     trades_buf.begin() +
-                                         static_cast<long>(trades_buf.size() - 500));
-                }
+            // Change gate: in a quiet market most ticks see neither a book
+            // mutation nor a new trade, so evaluation would reproduce the
+            // signals already cached in the engine. Skip it and spend the
+            // cycles on drain capacity instead.
+            const uint64_t book_version = st.book->version();
+            const bool unchanged = st.snapshot_valid &&
+                active_id == last_evaluated_id &&
+                book_version == st.last_eval_book_version &&
+                st.trade_seq == st.last_eval_trade_seq;
+            if (!unchanged) {
+                quantumflow::BookSnapshot& snapshot = sync_snapshot(active_id, st);
+                snapshot.timestamp_ns = now_ns();
 
-                strategy_engine.evaluate(snapshot, trades_buf);
+                strategy_engine.evaluate(snapshot, st.recent_trades.view());
+                last_evaluated_id = active_id;
+                st.last_eval_book_version = book_version;
+                st.last_eval_trade_seq = st.trade_seq;
             }
         }
         uint64_t strat_end = now_ns();
+        latency_hist.order_match.record_ns(strat_start - loop_start);
+        latency_hist.strategy_eval.record_ns(strat_end - strat_start);
+
+        // Post-match stamp for the sampled packet: matching for its frame
+        // is complete at strat_start (coalescer flushed, books mutated).
+        if (stage_trace_armed) {
+            if (strat_start >= stage_trace_drain_ns) {
+                latency_hist.drain_to_match.record_ns(
+                    strat_start - stage_trace_drain_ns);
+            }
+            stage_trace_armed = false;
+        }
 
 #ifndef QUANTUMFLOW_HEADLESS
         if (!cfg.headless) {
@@ -358,29 +921,142 @@ int main(int argc, char* argv[]) {
             if (now - last_broadcast_ns >= BROADCAST_INTERVAL_NS) {
                 uint64_t broadcast_start = now_ns();
 
-                for (const auto& [sym, book_ptr] : books) {
-                    quantumflow::BookSnapshot ws_snapshot = quantumflow::BookSnapshot::from_book(
-                        *book_ptr, sym, price_reg.get(sym));
-                    ws_snapshot.timestamp_ns = now;
-                    ws_server.broadcast(quantumflow::serialize_book(ws_snapshot));
+                {
+                    std::lock_guard<std::mutex> lock(ws_resync_mutex);
+                    for (const auto& sym : ws_resync_requests) {
+                        ws_book_streams[sym].need_full = true;
+                    }
+                    ws_resync_requests.clear();
                 }
 
-                for (auto& [sym, trades] : ws_trade_buffers) {
-                    ws_server.broadcast(
-                        quantumflow::serialize_trades(sym, trades, now));
-                    if (trades.size() > 200) {
-                        trades.erase(
-                            trades.begin(),
-                            trades.begin() +
-                                static_cast<long>(trades.size() - 200));
+                // Publish the JSON book stream (full snapshot or delta) plus
+                // the full binary frame for binary subscribers. While a topic
+                // has no JSON subscribers its stream is parked on need_full so
+                // the delta chain restarts cleanly.
+                auto publish_book = [&](const quantumflow::BookSnapshot& snap) {
+                    const std::string topic = "book." + snap.symbol;
+                    if (ws_server.has_subscribers(topic)) {
+                        WsBookStream& stream = ws_book_streams[snap.symbol];
+                        auto payload = quantumflow::acquire_payload();
+                        if (stream.need_full) {
+                            quantumflow::serialize_book(snap, stream.seq, *payload);
+                            stream.need_full = false;
+                        } else {
+                            quantumflow::serialize_book_delta(stream.last, snap,
+                                                              stream.seq, *payload);
+                        }
+                        ws_server.publish(topic, std::move(payload));
+                        stream.last = snap;
+                        ++stream.seq;
+                    } else {
+                        auto it = ws_book_streams.find(snap.symbol);
+                        if (it != ws_book_streams.end()) it->second.need_full = true;
+                    }
+                    if (ws_server.has_subscribers(topic, true)) {
+                        auto payload = quantumflow::acquire_payload();
+                        quantumflow::serialize_book_binary(snap, *payload);
+                        ws_server.publish(topic, std::move(payload), true);
+                    }
+                };
+
+                if (sharded_engine) {
+                    std::vector<quantumflow::BookSnapshot> shard_snapshots;
+                    std::vector<std::pair<std::string,
+                                          std::vector<quantumflow::TradeInfo>>> shard_trades;
+                    std::unordered_map<std::string,
+                                       quantumflow::StrategySignal> shard_signals;
+                    sharded_engine->collect(shard_snapshots, shard_trades, shard_signals);
+
+                    for (const auto& snap : shard_snapshots) {
+                        publish_book(snap);
+                    }
+                    for (const auto& [sym, trades] : shard_trades) {
+                        const std::string topic = "trades." + sym;
+                        if (ws_server.has_subscribers(topic)) {
+                            auto payload = quantumflow::acquire_payload();
+                            quantumflow::serialize_trades(sym, trades, now, *payload);
+                            ws_server.publish(topic, std::move(payload));
+                        }
+                        if (ws_server.has_subscribers(topic, true)) {
+                            auto payload = quantumflow::acquire_payload();
+                            quantumflow::serialize_trades_binary(sym, trades, now,
+                                                                 *payload);
+                            ws_server.publish(topic, std::move(payload), true);
+                        }
+                    }
+                    {
+                        auto payload = quantumflow::acquire_payload();
+                        quantumflow::serialize_strategies(shard_signals, now, *payload);
+                        ws_server.broadcast(std::move(payload));
+                    }
+                } else {
+                    for (quantumflow::SymbolId id = 0; id < symbol_states.size(); ++id) {
+                        SymbolState& st = symbol_states[id];
+                        if (!st.book) continue;
+
+                        const std::string& sym = symbol_table.name(id);
+                        const std::string book_topic = "book." + sym;
+                        const std::string trades_topic = "trades." + sym;
+
+                        if (ws_server.has_subscribers(book_topic) ||
+                            ws_server.has_subscribers(book_topic, true)) {
+                            quantumflow::BookSnapshot& ws_snapshot = sync_snapshot(id, st);
+                            ws_snapshot.timestamp_ns = now;
+                            publish_book(ws_snapshot);
+                        } else {
+                            auto it = ws_book_streams.find(sym);
+                            if (it != ws_book_streams.end()) it->second.need_full = true;
+                        }
+
+                        if (ws_server.has_subscribers(trades_topic)) {
+                            auto payload = quantumflow::acquire_payload();
+                            quantumflow::serialize_trades(sym, st.ws_trades.view(),
+                                                          now, *payload);
+                            ws_server.publish(trades_topic, std::move(payload));
+                        }
+                        if (ws_server.has_subscribers(trades_topic, true)) {
+                            auto payload = quantumflow::acquire_payload();
+                            quantumflow::serialize_trades_binary(
+                                sym, st.ws_trades.view(), now, *payload);
+                            ws_server.publish(trades_topic, std::move(payload), true);
+                        }
+                    }
+
+                    {
+                        const auto& sigs = strategy_engine.all_signals();
+                        auto payload = quantumflow::acquire_payload();
+                        quantumflow::serialize_strategies(
+                            sigs.data(), sigs.size(), now, *payload);
+                        ws_server.broadcast(std::move(payload));
                     }
                 }
 
-                ws_server.broadcast(
-                    quantumflow::serialize_strategies(
-                        strategy_engine.all_signals(), now));
+                // Answer queued strategy_history requests from the main
+                // engine's transition rings. Sharded mode keeps its
+                // histories inside the shard-local engines, which are not
+                // collectible here; those requests are dropped.
+                {
+                    std::vector<std::string> history_requests;
+                    {
+                        std::lock_guard<std::mutex> lock(ws_history_mutex);
+                        history_requests.swap(ws_history_requests);
+                    }
+                    for (const auto& name : history_requests) {
+                        const quantumflow::SignalHistoryRing* hist =
+                            sharded_engine ? nullptr
+                                           : strategy_engine.history(name);
+                        if (!hist) continue;
+                        auto payload = quantumflow::acquire_payload();
+                        quantumflow::serialize_strategy_history(name, *hist,
+                                                                now, *payload);
+                        ws_server.broadcast(std::move(payload));
+                    }
+                }
 
                 uint64_t broadcast_end = now_ns();
+                latency_hist.ws_broadcast.record_ns(broadcast_end - broadcast_start);
+                latency_hist.total.record_ns(broadcast_end - loop_start);
+
                 quantumflow::LatencySnapshot lat{};
                 lat.python_to_cpp_us = latest_python_to_cpp_us;
                 lat.order_match_us = ns_to_us(strat_start - loop_start);
@@ -388,8 +1064,21 @@ int main(int argc, char* argv[]) {
                 lat.ws_broadcast_us = ns_to_us(broadcast_end - broadcast_start);
                 lat.total_us = ns_to_us(broadcast_end - loop_start);
 
-                ws_server.broadcast(
-                    quantumflow::serialize_latency(lat, now));
+                {
+                    auto payload = quantumflow::acquire_payload();
+                    if (active_id != quantumflow::INVALID_SYMBOL_ID &&
+                        active_id < symbol_states.size() &&
+                        symbol_states[active_id].book) {
+                        quantumflow::serialize_latency(
+                            lat, latency_hist.stats(),
+                            symbol_states[active_id].book->pool_stats(), now,
+                            *payload);
+                    } else {
+                        quantumflow::serialize_latency(lat, latency_hist.stats(),
+                                                       now, *payload);
+                    }
+                    ws_server.broadcast(std::move(payload));
+                }
 
                 last_broadcast_ns = now;
             }
@@ -398,20 +1087,99 @@ int main(int argc, char* argv[]) {
         }
 #endif
 
+        // Start a fresh histogram window every few seconds so the
+        // percentiles track current behaviour rather than the whole run.
+        if (now_ns() - last_hist_reset_ns >= HIST_RESET_INTERVAL_NS) {
+            latency_hist.reset();
+            last_hist_reset_ns = now_ns();
+        }
+
+        // Periodic warm-start images: books whose version moved since the
+        // last pass are re-serialized atomically, so the on-disk image is
+        // never more than one interval stale and untouched symbols cost
+        // nothing.
+        if (!cfg.warm_start_dir.empty() &&
+            now_ns() - last_book_image_ns >= BOOK_IMAGE_INTERVAL_NS) {
+            const uint64_t saved_ns = now_ns();
+            for (quantumflow::SymbolId id = 0; id < symbol_states.size(); ++id) {
+                SymbolState& st = symbol_states[id];
+                if (!st.book || st.book->version() == st.last_image_version) {
+                    continue;
+                }
+                const std::string path = quantumflow::book_image_path(
+                    cfg.warm_start_dir, symbol_table.name(id));
+                if (quantumflow::write_book_image(*st.book, symbol_table.name(id),
+                                                  path, saved_ns)) {
+                    st.last_image_version = st.book->version();
+                }
+            }
+            last_book_image_ns = now_ns();
+        }
+
         if (cfg.headless) {
             loop_count++;
             if (loop_count % 1000 == 0) {
                 std::printf("[loop %lu] bridge: pushed=%lu popped=%lu dropped=%lu | "
-                            "uds_rx=%lu uds_bad=%lu | drained=%d | strategies=%zu\n",
+                            "shm: pushed=%lu popped=%lu dropped=%lu | "
+                            "uds_rx=%lu uds_bad=%lu | drained=%d coalesced=%lu "
+                            "cksum_miss=%lu | strategies=%zu\n",
                             loop_count,
                             bridge.push_count(), bridge.pop_count(), bridge.drop_count(),
+                            shm_bridge.push_count(), shm_bridge.pop_count(),
+                            shm_bridge.drop_count(),
                             bridge_socket_rx, bridge_socket_bad,
-                            drained, strategy_engine.strategy_count());
+                            drained, level_coalescer.coalesced_count(),
+                            checksum_mismatches,
+                            strategy_engine.strategy_count());
+                if (sharded_engine) {
+                    std::printf("[loop %lu] shards=%zu processed=%lu dropped=%lu\n",
+                                loop_count, sharded_engine->shard_count(),
+                                sharded_engine->processed_count(),
+                                sharded_engine->dropped_count());
+                }
+                // Pool occupancy across all books: in-use vs capacity plus
+                // lifetime high-water, so pool sizing can be tuned from
+                // production runs instead of guessed.
+                BookPoolStats pools_total{};
+                for (const auto& st : symbol_states) {
+                    if (!st.book) continue;
+                    BookPoolStats p = st.book->pool_stats();
+                    pools_total.orders.in_use += p.orders.in_use;
+                    pools_total.orders.capacity += p.orders.capacity;
+                    pools_total.orders.high_water += p.orders.high_water;
+                    pools_total.levels.in_use += p.levels.in_use;
+                    pools_total.levels.capacity += p.levels.capacity;
+                    pools_total.levels.high_water += p.levels.high_water;
+                }
+                std::printf("[loop %lu] pools: orders=%zu/%zu hw=%zu | "
+                            "levels=%zu/%zu hw=%zu\n",
+                            loop_count,
+                            pools_total.orders.in_use, pools_total.orders.capacity,
+                            pools_total.orders.high_water,
+                            pools_total.levels.in_use, pools_total.levels.capacity,
+                            pools_total.levels.high_water);
             }
-            // Small sleep in headless to avoid busy-spinning when no data
+            // Quiet iteration: escalate spin -> yield -> sleep instead of a
+            // fixed nanosleep, so the first packet after a lull is picked up
+            // within the spin window rather than after a 100 µs penalty.
             if (drained == 0) {
-                struct timespec ts = {0, 100000}; // 100us
-                nanosleep(&ts, nullptr);
+                if (!idle_wait.spinning()) {
+                    // Genuinely quiet (spin/yield budget exhausted): run the
+                    // maintenance that must never land inside a matching
+                    // call — tombstone compaction and pool reclaim.
+                    for (auto& st : symbol_states) {
+                        if (st.book) (void)st.book->maintain(256);
+                    }
+                    if (now_ns() - last_pool_reclaim_ns >= POOL_RECLAIM_INTERVAL_NS) {
+                        for (auto& st : symbol_states) {
+                            if (st.book) (void)st.book->reclaim_pools();
+                        }
+                        last_pool_reclaim_ns = now_ns();
+                    }
+                }
+                idle_wait.idle();
+            } else {
+                idle_wait.reset();
             }
         }
     }
@@ -422,14 +1190,49 @@ int main(int argc, char* argv[]) {
     }
 #endif
 
+    if (replay_thread.joinable()) {
+        replay_thread.join();
+    }
+    if (capture.is_open()) {
+        std::printf("Capture closed: %lu packets recorded to %s\n",
+                    capture.record_count(), cfg.capture_path.c_str());
+        capture.close();
+    }
+
+    if (journal.is_open()) {
+        journal.close();
+        std::printf("Journal closed: %lu trades written, %lu dropped (%s)\n",
+                    journal.written_count(), journal.dropped_count(),
+                    cfg.journal_path.c_str());
+    }
+
+    if (native_ingest) {
+        native_ingest->stop();
+        std::printf("Native ingest stopped: messages=%lu packets=%lu "
+                    "reconnects=%lu resubscribes=%lu\n",
+                    native_ingest->messages_parsed(),
+                    native_ingest->packets_emitted(),
+                    native_ingest->reconnects(),
+                    native_ingest->resubscribes());
+    }
+
+    if (sharded_engine) {
+        sharded_engine->stop();
+        std::printf("Sharded engine stopped: processed=%lu dropped=%lu\n",
+                    sharded_engine->processed_count(),
+                    sharded_engine->dropped_count());
+    }
+
     if (bridge_socket_fd >= 0) {
         ::close(bridge_socket_fd);
         (void)::unlink(cfg.bridge_socket_path.c_str());
     }
 
     std::printf("QuantumFlow shutdown. Bridge stats: pushed=%lu popped=%lu dropped=%lu | "
-                "uds_rx=%lu uds_bad=%lu\n",
+                "shm: pushed=%lu popped=%lu dropped=%lu | uds_rx=%lu uds_bad=%lu\n",
                 bridge.push_count(), bridge.pop_count(), bridge.drop_count(),
+                shm_bridge.push_count(), shm_bridge.pop_count(), shm_bridge.drop_count(),
                 bridge_socket_rx, bridge_socket_bad);
+    shm_bridge.close_and_unlink();
     return 0;
 }
@@ -1,14 +1,48 @@
 #ifndef LOB_BOOK_H
 #define LOB_BOOK_H
 
+#include <array>
 #include <vector>
+#include "Checksum.h"
 #include "Level.h"
 #include "SlabPool.h"
 #include "FlatHashMap.h"
+#include "LadderIndex.h"
 
 using PriceLevelMap = FlatHashMap<PRICE, Level*>;
 using Orders = FlatHashMap<ID, Order*>;
 
+/**
+ * DepthEntry: one price level of the top-of-book depth view.
+ * Plain aggregate so strategy code can consume depth with no allocation.
+ */
+struct DepthEntry {
+    PRICE price;
+    Volume volume;
+    Length order_count;
+};
+
+/**
+ * OrderRequest: one order submission for the batched place_orders path.
+ * Plain aggregate mirroring the place_order parameter list.
+ */
+struct OrderRequest {
+    ID order_id;
+    ID agent_id;
+    OrderType order_type;
+    PRICE price;
+    Volume volume;
+};
+
+/**
+ * BookPoolStats: occupancy telemetry for the book's two object pools,
+ * surfaced through the periodic stats line and the latency frame.
+ */
+struct BookPoolStats {
+    SlabPoolStats orders;
+    SlabPoolStats levels;
+};
+
 /**
  * Book: High-performance limit order book matching engine.
  *
@@ -27,6 +61,11 @@ using Orders = FlatHashMap<ID, Order*>;
  * - id_to_order only contains resting orders
  */
 class Book {
+    public:
+        // Maximum depth served by top_of_book; strategies read at most the
+        // top handful of levels (OrderBookImbalance uses 5).
+        static constexpr size_t MAX_DEPTH_VIEW = 16;
+
     private:
         // Price level maps (price -> Level*)
         PriceLevelMap buy_side_limits;
@@ -40,6 +79,28 @@ class Book {
         Level*& best_bid;
         Level*& best_ask;
 
+        // Contiguous ladder indexes accelerating the dense band around
+        // mid: one-cache-line level lookup and bitmap neighbour queries
+        // for sorted inserts. The hash maps and intrusive lists above stay
+        // authoritative; prices outside the window fall back to them.
+        LadderIndex buy_ladder;
+        LadderIndex sell_ladder;
+
+        void index_level(Level* level, bool is_buy);
+        void rebuild_ladder(bool is_buy, PRICE center);
+
+        // Warm the caches for an upcoming level lookup at price.
+        void prefetch_level(PRICE price, bool is_buy) const {
+            const LadderIndex& ladder = is_buy ? buy_ladder : sell_ladder;
+            if (ladder.covers(price)) {
+                ladder.prefetch(price);
+            } else if (is_buy) {
+                buy_side_limits.prefetch(price);
+            } else {
+                sell_side_limits.prefetch(price);
+            }
+        }
+
         // Order lookup (only for resting orders)
         Orders id_to_order;
 
@@ -51,9 +112,110 @@ class Book {
         static constexpr size_t TRADE_BUFFER_SIZE = 16;
         mutable std::vector<Trade> trade_buffer;
 
+        // Monotonic mutation counter; see version().
+        std::uint64_t version_;
+
+        // Dirty-level tracking for incremental snapshots.
+        // Levels touched since the last clear_dirty_levels() are recorded
+        // once per epoch (deduped via Level::dirty_epoch).
+        std::uint64_t dirty_epoch;
+        std::vector<PRICE> dirty_buy_levels;
+        std::vector<PRICE> dirty_sell_levels;
+
+        void mark_level_dirty(Level* level, bool is_buy);
+
+        // Cached top-of-book depth views (see top_of_book). Marked stale on
+        // any level touch and lazily rebuilt by walking at most
+        // MAX_DEPTH_VIEW nodes of the sorted intrusive lists.
+        mutable std::array<DepthEntry, MAX_DEPTH_VIEW> buy_depth_cache;
+        mutable std::array<DepthEntry, MAX_DEPTH_VIEW> sell_depth_cache;
+        mutable size_t buy_depth_cached;
+        mutable size_t sell_depth_cached;
+        mutable bool buy_depth_stale;
+        mutable bool sell_depth_stale;
+
+        size_t refresh_depth_cache(bool is_buy) const;
+
+        // Rolling top-of-book checksum cache (see top_checksum). The
+        // cached value stays valid while mutations land strictly outside
+        // the checksummed window; floor/ceil record the boundary prices
+        // of the window at the last rebuild.
+        mutable uint32_t top_checksum_cache_;
+        mutable size_t checksum_depth_cached_;
+        mutable bool checksum_stale_;
+        mutable PRICE checksum_bid_floor_;
+        mutable PRICE checksum_ask_ceil_;
+
         Level* get_or_create_level(PRICE price, bool is_buy);
-        bool match_against_level(Order* incoming_order, Level* level);
         void insert_resting_order(Order* order);
+
+        // Matching core shared by both place_order flavours. sink is
+        // invoked once per fill; returns true when the level emptied.
+        template <typename TradeSink>
+        bool match_against_level(Order* incoming_order, Level* level,
+                                 TradeSink& sink) {
+            if (LOB_UNLIKELY(!incoming_order || !level || level->is_empty())) {
+                return false;
+            }
+
+            while (level->get_head() && !incoming_order->is_fulfilled()) {
+                Order* resting_order = level->get_head();
+                Volume resting_remaining = resting_order->get_remaining_volume();
+                Volume incoming_remaining = incoming_order->get_remaining_volume();
+                Volume fill_volume = (resting_remaining < incoming_remaining)
+                                    ? resting_remaining
+                                    : incoming_remaining;
+
+                resting_order->fill(fill_volume);
+                incoming_order->fill(fill_volume);
+                level->decrease_volume(fill_volume);
+
+                sink(Trade(
+                    incoming_order->get_order_id(),
+                    resting_order->get_order_id(),
+                    level->get_price(),
+                    fill_volume
+                ));
+
+                if (resting_order->is_fulfilled()) {
+                    resting_order->set_order_status(FULFILLED);
+                    Order* fulfilled_order = level->pop_front();
+                    id_to_order.erase(fulfilled_order->get_order_id());
+                    order_pool.deallocate(fulfilled_order);
+                }
+            }
+
+            // L2 aggregate levels (set_level) carry volume but no resting
+            // Order objects. Consume the aggregate directly — otherwise a
+            // crossing order on a mixed L2/L3 feed would see a non-empty
+            // headless level and the caller's loop could never progress.
+            // The synthetic counterparty order id is 0.
+            if (!incoming_order->is_fulfilled() && !level->get_head() &&
+                !level->is_empty()) {
+                Volume available = level->get_total_volume();
+                Volume incoming_remaining = incoming_order->get_remaining_volume();
+                Volume fill_volume = (available < incoming_remaining)
+                                    ? available
+                                    : incoming_remaining;
+                if (fill_volume > 0) {
+                    incoming_order->fill(fill_volume);
+                    level->decrease_volume(fill_volume);
+                    sink(Trade(
+                        incoming_order->get_order_id(),
+                        0,
+                        level->get_price(),
+                        fill_volume
+                    ));
+                }
+                if (level->get_total_volume() == 0) {
+                    // Aggregate exhausted (or was already hollow): clear the
+                    // order count so is_empty() lets the caller unlink it.
+                    level->set_aggregate(0, 0);
+                }
+            }
+
+            return level->is_empty();
+        }
         void remove_order_from_level(Order* order, bool is_buy);
 
         // Intrusive sorted list helpers
@@ -77,8 +239,102 @@ class Book {
             Volume volume
         );
 
+        // Caller-supplied trade sink variant: sink(const Trade&) runs once
+        // per fill, inside the matching loop, so match results are written
+        // directly where the consumer needs them. The sink is a template
+        // parameter so the call inlines; the buffered overload above stays
+        // for callers that want the vector view and is a wrapper over this.
+        template <typename TradeSink>
+        void place_order(
+            ID order_id,
+            ID agent_id,
+            OrderType order_type,
+            PRICE price,
+            Volume volume,
+            TradeSink&& sink
+        ) {
+            if (LOB_UNLIKELY(price <= 0 || volume == 0)) {
+                return;
+            }
+
+            Order* order = order_pool.allocate(
+                order_id, agent_id, order_type, price, volume, volume, ACTIVE
+            );
+
+            if (order_type == BUY) {
+                while (best_ask && price >= best_ask->get_price() &&
+                       !order->is_fulfilled()) {
+                    mark_level_dirty(best_ask, false);
+                    bool level_empty = match_against_level(order, best_ask, sink);
+                    if (level_empty) {
+                        PRICE empty_price = best_ask->get_price();
+                        Level* empty_level = best_ask;
+                        // Unlink from sorted list BEFORE deallocation
+                        remove_level_from_sell_list(empty_level);
+                        sell_side_limits.erase(empty_price);
+                        sell_ladder.erase(empty_price);
+                        level_pool.deallocate(empty_level);
+                    }
+                }
+            } else {
+                while (best_bid && price <= best_bid->get_price() &&
+                       !order->is_fulfilled()) {
+                    mark_level_dirty(best_bid, true);
+                    bool level_empty = match_against_level(order, best_bid, sink);
+                    if (level_empty) {
+                        PRICE empty_price = best_bid->get_price();
+                        Level* empty_level = best_bid;
+                        remove_level_from_buy_list(empty_level);
+                        buy_side_limits.erase(empty_price);
+                        buy_ladder.erase(empty_price);
+                        level_pool.deallocate(empty_level);
+                    }
+                }
+            }
+
+            if (!order->is_fulfilled()) {
+                insert_resting_order(order);
+            } else {
+                order_pool.deallocate(order);
+            }
+        }
+
+        // Batched submission: processes requests in order, emitting every
+        // fill through sink as in the single-order overload. While order i
+        // matches, the level index entries for order i+2 are software-
+        // prefetched (ladder slot and Level node in the dense band, hash
+        // map home slot outside it), hiding the lookup cache misses that
+        // dominate matching time on replay batches.
+        template <typename TradeSink>
+        void place_orders(const OrderRequest* requests, size_t n,
+                          TradeSink&& sink) {
+            static constexpr size_t PREFETCH_DISTANCE = 2;
+            for (size_t i = 0; i < n; ++i) {
+                if (i + PREFETCH_DISTANCE < n) {
+                    const OrderRequest& ahead = requests[i + PREFETCH_DISTANCE];
+                    prefetch_level(ahead.price, ahead.order_type == BUY);
+                }
+                const OrderRequest& r = requests[i];
+                place_order(r.order_id, r.agent_id, r.order_type,
+                            r.price, r.volume, sink);
+            }
+        }
+
         void delete_order(ID id);
 
+        // Amends a resting order's remaining volume. Volume decreases keep
+        // queue priority; increases re-queue the order at the back of its
+        // level (cancel/replace semantics). Volume 0 cancels. Unknown or
+        // inactive ids are a no-op, matching delete_order.
+        void modify_order(ID id, Volume new_volume);
+
+        // L2 depth fast path: directly create/update/remove the level at
+        // price (volume 0 removes it) without allocating Order objects or
+        // running the matching engine. Mixed feeds are safe: place_order
+        // matching consumes aggregate levels' volume directly (with a
+        // synthetic counterparty order id of 0 in the emitted trades).
+        void set_level(OrderType side, PRICE price, Volume volume);
+
         PRICE get_spread() const;
         double get_mid_price() const;
         PRICE get_best_buy() const;
@@ -97,6 +353,65 @@ class Book {
 
         void print() const;
         OrderStatus get_order_status(ID id) const;
+
+        // Off-hot-path index maintenance: spends up to budget_ops slot
+        // inspections compacting tombstones in the order and level hash
+        // maps (see FlatHashMap::maintain). Intended for idle loop
+        // iterations; returns the number of tombstones cleared, so
+        // callers can stop early once it reports 0.
+        size_t maintain(size_t budget_ops);
+
+        // Pool occupancy/high-water telemetry for both object pools.
+        BookPoolStats pool_stats() const {
+            return BookPoolStats{order_pool.stats(), level_pool.stats()};
+        }
+
+        // Hand fully-free pool slabs back to the OS (see SlabPool::reclaim).
+        // For long-running processes after bursts; call from idle loop
+        // iterations, never from the packet path. Returns slabs parked.
+        size_t reclaim_pools() {
+            return order_pool.reclaim() + level_pool.reclaim();
+        }
+
+        // Monotonically increasing mutation counter, bumped whenever a
+        // level is touched (place/delete/modify/set_level, including fills
+        // from matching). Equal versions across two reads mean the book
+        // content is unchanged, so consumers can skip recomputation; the
+        // converse does not hold (a no-op touch may still bump it).
+        std::uint64_t version() const { return version_; }
+
+        // Canonical checksum over the top-depth (price, volume) pairs of
+        // both sides (see BookChecksum for the byte layout). Maintained
+        // incrementally in the practical sense: mutations strictly below
+        // the Nth bid / above the Nth ask leave the cached value valid,
+        // so deep-book churn costs one price comparison; only in-window
+        // touches trigger a rebuild, bounded at depth nodes per side.
+        uint32_t top_checksum(size_t depth = BookChecksum::DEPTH) const;
+
+        // Feed-integrity check: compare against the producer-supplied
+        // expected checksum for the same depth. A false return means the
+        // book has diverged from the feed (dropped or misapplied update)
+        // and the symbol should be resynced.
+        bool verify(uint32_t expected, size_t depth = BookChecksum::DEPTH) const {
+            return top_checksum(depth) == expected;
+        }
+
+        // Dirty-level tracking: prices touched since the last snapshot sync.
+        // A dirty price may have been updated, created or removed; consumers
+        // re-probe the level maps to find its current state.
+        bool has_dirty_levels() const {
+            return !dirty_buy_levels.empty() || !dirty_sell_levels.empty();
+        }
+        const std::vector<PRICE>& get_dirty_buy_levels() const { return dirty_buy_levels; }
+        const std::vector<PRICE>& get_dirty_sell_levels() const { return dirty_sell_levels; }
+        void clear_dirty_levels();
+
+        // Top-N depth view. Copies up to min(n, MAX_DEPTH_VIEW) entries for
+        // the given side into out (best price first) and returns the count.
+        // Served from a cached array that is rebuilt lazily after mutations,
+        // so the steady-state cost is a bounded copy: no allocation and no
+        // book walking on the caller's side.
+        size_t top_of_book(OrderType side, DepthEntry* out, size_t n) const;
 };
 
 #endif // LOB_BOOK_H
@@ -0,0 +1,94 @@
+#ifndef LOB_CHECKSUM_H
+#define LOB_CHECKSUM_H
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * ChecksumLevel: one (price, volume) pair in integer ticks, as fed to the
+ * canonical top-of-book checksum.
+ */
+struct ChecksumLevel {
+    std::uint64_t price;
+    std::uint64_t volume;
+};
+
+/**
+ * BookChecksum: canonical checksum over the top-N levels of both sides,
+ * shared by the book (cached, windowed invalidation) and feed producers
+ * (expected value computed per snapshot message).
+ *
+ * Algorithm: CRC32 (IEEE, reflected) over the ':'-joined decimal strings
+ * "bid1px:bid1sz:ask1px:ask1sz:bid2px:..." — best prices first, ranks
+ * interleaved, a side that runs out of levels simply stops contributing.
+ * Same shape as the venue checksums (OKX books channels), but over the
+ * integer tick representation the wire protocol carries, so producer and
+ * consumer agree without keeping the original decimal strings around.
+ */
+class BookChecksum {
+    public:
+        // Depth covered; matches the 25 ranks OKX checksums per side.
+        static constexpr std::size_t DEPTH = 25;
+
+        static std::uint32_t crc32(const char* data, std::size_t len) {
+            const std::uint32_t* tbl = table();
+            std::uint32_t crc = 0xFFFFFFFFu;
+            for (std::size_t i = 0; i < len; ++i) {
+                crc = (crc >> 8) ^
+                      tbl[(crc ^ static_cast<unsigned char>(data[i])) & 0xFF];
+            }
+            return crc ^ 0xFFFFFFFFu;
+        }
+
+        static std::uint32_t compute(const ChecksumLevel* bids,
+                                     std::size_t n_bids,
+                                     const ChecksumLevel* asks,
+                                     std::size_t n_asks) {
+            if (n_bids > DEPTH) n_bids = DEPTH;
+            if (n_asks > DEPTH) n_asks = DEPTH;
+
+            // Two 20-digit u64 fields plus separators per pair, two pairs
+            // per rank: comfortably inside a stack buffer.
+            char buf[DEPTH * 2 * 42];
+            char* p = buf;
+            const std::size_t ranks = n_bids > n_asks ? n_bids : n_asks;
+            for (std::size_t i = 0; i < ranks; ++i) {
+                if (i < n_bids) p = append_pair(p, bids[i]);
+                if (i < n_asks) p = append_pair(p, asks[i]);
+            }
+            if (p > buf) --p; // drop the trailing ':'
+            return crc32(buf, static_cast<std::size_t>(p - buf));
+        }
+
+    private:
+        static char* append_u64(char* p, std::uint64_t v) {
+            return std::to_chars(p, p + 20, v).ptr;
+        }
+
+        static char* append_pair(char* p, const ChecksumLevel& l) {
+            p = append_u64(p, l.price);
+            *p++ = ':';
+            p = append_u64(p, l.volume);
+            *p++ = ':';
+            return p;
+        }
+
+        static const std::uint32_t* table() {
+            static const std::array<std::uint32_t, 256> tbl = [] {
+                std::array<std::uint32_t, 256> t{};
+                for (std::uint32_t i = 0; i < 256; ++i) {
+                    std::uint32_t c = i;
+                    for (int k = 0; k < 8; ++k) {
+                        c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                    }
+                    t[i] = c;
+                }
+                return t;
+            }();
+            return tbl.data();
+        }
+};
+
+#endif // LOB_CHECKSUM_H
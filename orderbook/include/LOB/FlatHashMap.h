@@ -38,10 +38,16 @@ private:
     size_t capacity_;   // always power of 2
     size_t size_;       // number of OCCUPIED slots
     size_t used_;       // OCCUPIED + TOMBSTONE (for probing load)
+    size_t maint_cursor_; // next slot maintain() inspects
 
     static constexpr size_t MIN_CAPACITY = 16;
     static constexpr double MAX_LOAD = 0.70;
 
+    // Slots inspected by the compaction piggybacked on each erase(key).
+    // Enough to keep tombstone count roughly stable under cancel-heavy
+    // flow without a measurable cost on the cancel path.
+    static constexpr size_t COMPACT_OPS_PER_ERASE = 8;
+
     // Fibonacci hash for uint64_t keys
     static size_t fib_hash(uint64_t key) {
         return static_cast<size_t>(key * UINT64_C(11400714819323198485));
@@ -91,6 +97,7 @@ private:
         slots_ = new_slots;
         capacity_ = new_cap;
         used_ = size_; // tombstones cleared
+        maint_cursor_ = 0;
     }
 
 public:
@@ -99,10 +106,11 @@ public:
         , capacity_(MIN_CAPACITY)
         , size_(0)
         , used_(0)
+        , maint_cursor_(0)
     {}
 
     explicit FlatHashMap(size_t initial_capacity)
-        : size_(0), used_(0)
+        : size_(0), used_(0), maint_cursor_(0)
     {
         // round up to power of 2
         size_t cap = MIN_CAPACITY;
@@ -120,11 +128,13 @@ public:
     // Movable
     FlatHashMap(FlatHashMap&& o) noexcept
         : slots_(o.slots_), capacity_(o.capacity_), size_(o.size_), used_(o.used_)
+        , maint_cursor_(o.maint_cursor_)
     {
         o.slots_ = nullptr;
         o.capacity_ = 0;
         o.size_ = 0;
         o.used_ = 0;
+        o.maint_cursor_ = 0;
     }
 
     FlatHashMap& operator=(FlatHashMap&& o) noexcept {
@@ -134,10 +144,12 @@ public:
             capacity_ = o.capacity_;
             size_ = o.size_;
             used_ = o.used_;
+            maint_cursor_ = o.maint_cursor_;
             o.slots_ = nullptr;
             o.capacity_ = 0;
             o.size_ = 0;
             o.used_ = 0;
+            o.maint_cursor_ = 0;
         }
         return *this;
     }
@@ -170,6 +182,7 @@ public:
         slots_ = new_slots;
         capacity_ = new_cap;
         used_ = size_;
+        maint_cursor_ = 0;
     }
 
     // Iterator
@@ -232,6 +245,12 @@ public:
     const_iterator begin() const { return const_iterator(slots_, 0, capacity_); }
     const_iterator end() const { return const_iterator(slots_, capacity_, capacity_); }
 
+    // Software-prefetch the home slot for key so an upcoming find/insert
+    // probe starts from a warm cache line. Pure hint; keys need not exist.
+    void prefetch(const K& key) const {
+        LOB_PREFETCH(&slots_[slot_index(static_cast<uint64_t>(key))]);
+    }
+
     iterator find(const K& key) {
         size_t idx = slot_index(static_cast<uint64_t>(key));
         while (true) {
@@ -292,6 +311,70 @@ public:
         }
     }
 
+    size_t tombstone_count() const { return used_ - size_; }
+
+    /// Incremental tombstone compaction. Spends at most budget_ops slot
+    /// inspections clearing tombstones via backward shift: for each
+    /// tombstone, entries later in its probe cluster whose probe path
+    /// passes through it are shifted into it, and the hole left at the
+    /// cluster tail becomes EMPTY. The table is valid after every step,
+    /// so a budget that runs out mid-cluster just resumes on the next
+    /// call. Returns the number of tombstones cleared.
+    ///
+    /// Called with a small budget from erase(key) to amortize cleanup
+    /// across cancel flow, and with a large one from Book::maintain()
+    /// during idle loop iterations — so tombstone pressure never forces
+    /// a full rehash inside a matching call.
+    size_t maintain(size_t budget_ops) {
+        size_t cleared = 0;
+        const size_t mask = capacity_ - 1;
+        while (budget_ops > 0 && used_ > size_) {
+            if (slots_[maint_cursor_].state != TOMBSTONE) {
+                maint_cursor_ = (maint_cursor_ + 1) & mask;
+                --budget_ops;
+                continue;
+            }
+
+            // Walk the cluster after the tombstone at i. An OCCUPIED
+            // entry at j with home slot h can move into i exactly when h
+            // is not cyclically within (i, j], i.e. its probe path passes
+            // through i; lookups then find it earlier on the same path.
+            size_t i = maint_cursor_;
+            size_t j = i;
+            bool done = false;
+            while (budget_ops > 0) {
+                --budget_ops;
+                j = (j + 1) & mask;
+                if (slots_[j].state == EMPTY) {
+                    // No probe chain crosses i anymore; free it.
+                    slots_[i].state = EMPTY;
+                    --used_;
+                    ++cleared;
+                    done = true;
+                    break;
+                }
+                if (slots_[j].state == OCCUPIED) {
+                    const size_t h = slot_index(
+                        static_cast<uint64_t>(slots_[j].kv().first));
+                    const bool movable = (j > i) ? (h <= i || h > j)
+                                                 : (h <= i && h > j);
+                    if (movable) {
+                        new (&slots_[i].kv()) value_type(std::move(slots_[j].kv()));
+                        slots_[i].state = OCCUPIED;
+                        slots_[j].kv().~value_type();
+                        slots_[j].state = TOMBSTONE;
+                        i = j;
+                    }
+                }
+            }
+            if (!done) {
+                break; // budget exhausted mid-cluster; resume next call
+            }
+            maint_cursor_ = (maint_cursor_ + 1) & mask;
+        }
+        return cleared;
+    }
+
     // Erase by key
     size_t erase(const K& key) {
         size_t idx = slot_index(static_cast<uint64_t>(key));
@@ -301,6 +384,9 @@ public:
                 slots_[idx].kv().~value_type();
                 slots_[idx].state = TOMBSTONE;
                 --size_;
+                // Piggybacked compaction keeps tombstones from piling up
+                // between idle-time maintain() calls.
+                maintain(COMPACT_OPS_PER_ERASE);
                 return 1;
             }
             idx = (idx + 1) & (capacity_ - 1);
@@ -0,0 +1,156 @@
+#ifndef LOB_LADDER_INDEX_H
+#define LOB_LADDER_INDEX_H
+
+#include <array>
+#include <cstdint>
+#include "Types.h"
+#include "Macros.h"
+
+class Level;
+
+/**
+ * LadderIndex: contiguous price-ladder index for dense books.
+ *
+ * A fixed window of WINDOW consecutive prices is mapped to a Level*
+ * array with direct price - base indexing, plus an occupancy bitmap so
+ * the nearest occupied neighbour of any price is found with
+ * count-trailing/leading-zeros word scans instead of list walks.
+ *
+ * The ladder is an acceleration structure, not the source of truth: the
+ * Book keeps FlatHashMap and the sorted intrusive lists authoritative
+ * and consults the ladder first, falling back to them for prices outside
+ * the window. Invariant maintained by the Book: every live level whose
+ * price lies inside the current window is recorded here.
+ *
+ * The window slides with the market: an insert just beyond an edge asks
+ * for a recenter (rebuilt by the Book from the level list), while far
+ * outliers are left to the hash map so a single crossing order cannot
+ * thrash the window.
+ */
+class LadderIndex {
+public:
+    // Prices covered by the window. 4096 ticks around mid comfortably
+    // spans a dense perp band; the array is 32 KiB per side.
+    static constexpr size_t WINDOW = 4096;
+    static constexpr PRICE NO_PRICE = 0;
+
+    /// True when price falls inside the current window.
+    bool covers(PRICE price) const {
+        return initialized_ && price >= base_ && price < base_ + WINDOW;
+    }
+
+    /// Level at price, or nullptr when unoccupied or outside the window.
+    Level* get(PRICE price) const {
+        if (LOB_UNLIKELY(!covers(price))) {
+            return nullptr;
+        }
+        return slots_[price - base_];
+    }
+
+    /// Hint the cache about the slot for price (and the Level it holds)
+    /// ahead of an upcoming lookup. No-op outside the window.
+    void prefetch(PRICE price) const {
+        if (!covers(price)) {
+            return;
+        }
+        Level* level = slots_[price - base_];
+        LOB_PREFETCH(&slots_[price - base_]);
+        if (level) {
+            LOB_PREFETCH(level);
+        }
+    }
+
+    /// Record the level at price. Caller must ensure covers(price).
+    void set(PRICE price, Level* level) {
+        const size_t idx = price - base_;
+        slots_[idx] = level;
+        occupied_[idx >> 6] |= (uint64_t{1} << (idx & 63));
+    }
+
+    /// Drop the entry at price; no-op outside the window.
+    void erase(PRICE price) {
+        if (!covers(price)) {
+            return;
+        }
+        const size_t idx = price - base_;
+        slots_[idx] = nullptr;
+        occupied_[idx >> 6] &= ~(uint64_t{1} << (idx & 63));
+    }
+
+    /// Nearest occupied price strictly above price inside the window,
+    /// or NO_PRICE. price itself may lie outside the window.
+    PRICE nearest_above(PRICE price) const {
+        if (!initialized_ || price + 1 >= base_ + WINDOW) {
+            return NO_PRICE;
+        }
+        size_t idx = (price + 1 > base_) ? (price + 1 - base_) : 0;
+        size_t word = idx >> 6;
+        uint64_t bits = occupied_[word] & (~uint64_t{0} << (idx & 63));
+        while (true) {
+            if (bits) {
+                return base_ + static_cast<PRICE>((word << 6) +
+                       static_cast<size_t>(__builtin_ctzll(bits)));
+            }
+            if (++word >= WORDS) {
+                return NO_PRICE;
+            }
+            bits = occupied_[word];
+        }
+    }
+
+    /// Nearest occupied price strictly below price inside the window,
+    /// or NO_PRICE. price itself may lie outside the window.
+    PRICE nearest_below(PRICE price) const {
+        if (!initialized_ || price <= base_) {
+            return NO_PRICE;
+        }
+        size_t idx = (price - base_ < WINDOW) ? (price - base_ - 1)
+                                              : (WINDOW - 1);
+        size_t word = idx >> 6;
+        uint64_t bits = occupied_[word] &
+            (~uint64_t{0} >> (63 - (idx & 63)));
+        while (true) {
+            if (bits) {
+                return base_ + static_cast<PRICE>((word << 6) + 63 -
+                       static_cast<size_t>(__builtin_clzll(bits)));
+            }
+            if (word-- == 0) {
+                return NO_PRICE;
+            }
+            bits = occupied_[word];
+        }
+    }
+
+    /// True when price is outside the window but close enough (within one
+    /// window length of an edge) that sliding the window onto it is
+    /// worthwhile. Far outliers stay hash-map-only.
+    bool should_recenter(PRICE price) const {
+        if (!initialized_) {
+            return true;
+        }
+        if (price < base_) {
+            return base_ - price <= WINDOW;
+        }
+        const PRICE top = base_ + WINDOW;
+        return price >= top && price - top < WINDOW;
+    }
+
+    /// Clear and center the window on price. The caller re-registers the
+    /// in-window levels afterwards.
+    void reset(PRICE center) {
+        base_ = (center > WINDOW / 2) ? center - WINDOW / 2 : 1;
+        initialized_ = true;
+        slots_.fill(nullptr);
+        occupied_.fill(0);
+    }
+
+private:
+    static constexpr size_t WORDS = WINDOW / 64;
+
+    PRICE base_ = 0;
+    bool initialized_ = false;
+    std::array<Level*, WINDOW> slots_{};
+    std::array<uint64_t, WORDS> occupied_{};
+};
+
+#endif // LOB_LADDER_INDEX_H
@@ -28,6 +28,8 @@ class Level {
         Level* prev_level; /**< Previous level in sorted intrusive list */
         Level* next_level; /**< Next level in sorted intrusive list */
 
+        std::uint64_t dirty_epoch; /**< Book snapshot epoch this level was last marked dirty in */
+
     public:
         Level(PRICE price):
             limit_price(price),
@@ -36,7 +38,8 @@ class Level {
             head(nullptr),
             tail(nullptr),
             prev_level(nullptr),
-            next_level(nullptr)
+            next_level(nullptr),
+            dirty_epoch(0)
         {}
         
         /**
@@ -64,7 +67,28 @@ class Level {
         void decrease_volume(Volume volume) {
             total_volume -= volume;
         }
+
+        /**
+         * @brief Increases total volume (used during in-place order amends)
+         * @param volume volume to add
+         */
+        void increase_volume(Volume volume) {
+            total_volume += volume;
+        }
         
+        /**
+         * @brief Overwrites the aggregate volume/order count directly
+         * @param volume new total volume
+         * @param orders new order count
+         *
+         * Used by Book::set_level for L2 depth levels that carry no
+         * resting Order objects.
+         */
+        void set_aggregate(Volume volume, Length orders) {
+            total_volume = volume;
+            order_number = orders;
+        }
+
         /**
          * @brief Checks if the level is empty (i.e. no orders)
          * @return true if there are no orders, false otherwise
@@ -84,6 +108,9 @@ class Level {
         Level* get_next_level() const { return next_level; }
         void set_next_level(Level* n) { next_level = n; }
 
+        std::uint64_t get_dirty_epoch() const { return dirty_epoch; }
+        void set_dirty_epoch(std::uint64_t e) { dirty_epoch = e; }
+
         /** Print method (for debugging) */
         void print() const;
 };
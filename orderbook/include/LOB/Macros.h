@@ -4,9 +4,11 @@
 #if defined(__GNUC__) || defined(__clang__)
     #define LOB_LIKELY(x)   __builtin_expect(!!(x), 1)
     #define LOB_UNLIKELY(x) __builtin_expect(!!(x), 0)
+    #define LOB_PREFETCH(addr) __builtin_prefetch(addr)
 #else
     #define LOB_LIKELY(x)   (x)
     #define LOB_UNLIKELY(x) (x)
+    #define LOB_PREFETCH(addr) ((void)0)
 #endif
 
 #endif // LOB_MACROS_H
@@ -73,6 +73,17 @@ class Order {
         OrderStatus get_order_status() const;
 
         void set_order_status(OrderStatus order_status);
+
+        /**
+         * @brief Amends the remaining volume in place (modify event path)
+         * @param new_remaining new remaining volume
+         */
+        void amend_remaining_volume(Volume new_remaining) {
+            remaining_volume = new_remaining;
+            if (new_remaining > initial_volume) {
+                initial_volume = new_remaining;
+            }
+        }
         
         // Intrusive list accessors (for Level class)
         Order* get_prev_order() const { return prev_order; }
@@ -13,6 +13,19 @@
 #include <sys/mman.h>
 #endif
 
+/**
+ * SlabPoolStats: occupancy telemetry snapshot for one pool.
+ * in_use/high_water count live objects; reclaimed_slabs is cumulative.
+ */
+struct SlabPoolStats {
+    size_t capacity;        // total objects across all slabs (incl. parked)
+    size_t in_use;          // currently allocated objects
+    size_t high_water;      // peak in_use over the pool's lifetime
+    size_t slab_count;      // slabs owned by the pool
+    size_t parked_slabs;    // slabs currently returned to the OS via reclaim()
+    size_t reclaimed_slabs; // cumulative slabs parked by reclaim() calls
+};
+
 /**
  * SlabPool: O(1) free-list based object pool allocator for hot-path allocations.
  *
@@ -38,8 +51,9 @@ private:
     struct Slab {
         char* storage;   // pointer to allocated storage
         bool use_mmap;   // track allocation method for cleanup
+        bool parked;     // pages handed back via MADV_FREE; nodes off the free list
 
-        Slab() : storage(nullptr), use_mmap(false) {
+        Slab() : storage(nullptr), use_mmap(false), parked(false) {
             allocate_storage();
         }
 
@@ -86,6 +100,34 @@ private:
     FreeNode* free_list_;
     size_t total_capacity_;
     size_t allocated_count_;
+    size_t high_water_;
+    size_t parked_slabs_;
+    size_t reclaimed_slabs_;
+
+    // Rebuild a slab's free-node chain onto the free list. Writing every
+    // node's next pointer dirties each cache line, so this doubles as the
+    // page-touch step: it faults the slab in (or back in, after reclaim).
+    void link_slab_nodes(Slab* slab) {
+        for (size_t i = 0; i < SLAB_SZ; ++i) {
+            FreeNode* node = reinterpret_cast<FreeNode*>(slab->storage + i * OBJECT_SIZE);
+            node->next = free_list_;
+            free_list_ = node;
+        }
+    }
+
+    // Bring one parked slab back into service. Called when the free list
+    // runs dry before growing the pool, so reclaimed memory is reused
+    // before new slabs are mapped.
+    bool unpark_slab() {
+        for (const auto& slab : slabs_) {
+            if (!slab->parked) continue;
+            slab->parked = false;
+            --parked_slabs_;
+            link_slab_nodes(slab.get());
+            return true;
+        }
+        return false;
+    }
 
     static FreeNode* to_free_node(T* obj) {
         return reinterpret_cast<FreeNode*>(obj);
@@ -113,7 +155,10 @@ public:
     SlabPool(size_t initial_capacity = SLAB_SZ)
         : free_list_(nullptr),
           total_capacity_(0),
-          allocated_count_(0) {
+          allocated_count_(0),
+          high_water_(0),
+          parked_slabs_(0),
+          reclaimed_slabs_(0) {
         size_t initial_slabs = (initial_capacity + SLAB_SZ - 1) / SLAB_SZ;
         for (size_t i = 0; i < initial_slabs; ++i) {
             add_slab();
@@ -122,6 +167,7 @@ public:
 
     ~SlabPool() {
         for (const auto& slab : slabs_) {
+            if (slab->parked) continue; // no live objects, contents reclaimed
             for (size_t i = 0; i < SLAB_SZ; ++i) {
                 T* obj = reinterpret_cast<T*>(slab->storage + i * OBJECT_SIZE);
                 bool in_free_list = false;
@@ -146,18 +192,32 @@ public:
         Slab* slab_ptr = slab.get();
         slabs_.push_back(std::move(slab));
         total_capacity_ += SLAB_SZ;
+        link_slab_nodes(slab_ptr);
+    }
 
-        for (size_t i = 0; i < SLAB_SZ; ++i) {
-            FreeNode* node = reinterpret_cast<FreeNode*>(slab_ptr->storage + i * OBJECT_SIZE);
-            node->next = free_list_;
-            free_list_ = node;
+    // Ensure capacity for at least n_objects and fault every backing page
+    // in, so slab growth and first-touch page faults happen at startup
+    // rather than inside the first busy minutes of matching. Safe to call
+    // at any point; already-live objects are never written.
+    void prewarm(size_t n_objects) {
+        while (total_capacity_ < n_objects) {
+            if (!unpark_slab()) {
+                add_slab();
+            }
+        }
+        // Touch every free node: rewriting next in place dirties one cache
+        // line per object, covering each page of every non-parked slab.
+        for (FreeNode* node = free_list_; node; node = node->next) {
+            *const_cast<FreeNode* volatile*>(&node->next) = node->next;
         }
     }
 
     template<typename... Args>
     T* allocate(Args&&... args) {
         if (LOB_UNLIKELY(!free_list_)) {
-            add_slab();
+            if (!unpark_slab()) {
+                add_slab();
+            }
         }
 
         FreeNode* node = free_list_;
@@ -166,6 +226,9 @@ public:
         T* obj = to_object(node);
         new (obj) T(std::forward<Args>(args)...);
         ++allocated_count_;
+        if (LOB_UNLIKELY(allocated_count_ > high_water_)) {
+            high_water_ = allocated_count_;
+        }
 
         return obj;
     }
@@ -185,8 +248,70 @@ public:
         --allocated_count_;
     }
 
+    // Hand fully-free slabs back to the OS with madvise(MADV_FREE): the
+    // mapping stays, the kernel may reclaim the pages lazily, and the next
+    // allocate() revives parked slabs before mapping new ones. One slab is
+    // always kept resident so a quiet pool still serves the next burst
+    // without a page fault. O(free objects x slabs); call off the hot path,
+    // after bursts. Returns the number of slabs parked by this call.
+    size_t reclaim() {
+#ifdef __linux__
+        if (slabs_.size() <= 1) return 0;
+
+        // Count free nodes per slab; a slab is reclaimable only when every
+        // one of its objects is on the free list.
+        std::vector<size_t> free_per_slab(slabs_.size(), 0);
+        for (FreeNode* node = free_list_; node; node = node->next) {
+            char* p = reinterpret_cast<char*>(node);
+            for (size_t s = 0; s < slabs_.size(); ++s) {
+                if (p >= slabs_[s]->storage && p < slabs_[s]->storage + SLAB_BYTES) {
+                    ++free_per_slab[s];
+                    break;
+                }
+            }
+        }
+
+        size_t parked_now = 0;
+        size_t resident = slabs_.size() - parked_slabs_;
+        for (size_t s = 0; s < slabs_.size(); ++s) {
+            if (resident <= 1) break;
+            Slab* slab = slabs_[s].get();
+            if (slab->parked || !slab->use_mmap || free_per_slab[s] != SLAB_SZ) {
+                continue;
+            }
+            // Unlink this slab's nodes before the pages go away.
+            FreeNode** link = &free_list_;
+            while (*link) {
+                char* p = reinterpret_cast<char*>(*link);
+                if (p >= slab->storage && p < slab->storage + SLAB_BYTES) {
+                    *link = (*link)->next;
+                } else {
+                    link = &(*link)->next;
+                }
+            }
+            ::madvise(slab->storage, SLAB_BYTES, MADV_FREE);
+            slab->parked = true;
+            ++parked_slabs_;
+            ++reclaimed_slabs_;
+            ++parked_now;
+            --resident;
+        }
+        return parked_now;
+#else
+        return 0;
+#endif
+    }
+
     size_t capacity() const { return total_capacity_; }
     size_t size() const { return allocated_count_; }
+    size_t high_water() const { return high_water_; }
+
+    SlabPoolStats stats() const {
+        return SlabPoolStats{
+            total_capacity_, allocated_count_, high_water_,
+            slabs_.size(),   parked_slabs_,    reclaimed_slabs_,
+        };
+    }
 };
 
 #endif // LOB_SLAB_POOL_H
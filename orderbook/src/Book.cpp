@@ -10,12 +10,30 @@ Book::Book(size_t initial_capacity)
       best_bid(buy_list_head),
       best_ask(sell_list_head),
       order_pool(initial_capacity),
-      level_pool(initial_capacity / 16) {
+      level_pool(initial_capacity / 16),
+      version_(0),
+      dirty_epoch(1),
+      buy_depth_cached(0),
+      sell_depth_cached(0),
+      buy_depth_stale(true),
+      sell_depth_stale(true),
+      top_checksum_cache_(0),
+      checksum_depth_cached_(0),
+      checksum_stale_(true),
+      checksum_bid_floor_(0),
+      checksum_ask_ceil_(std::numeric_limits<PRICE>::max()) {
     trade_buffer.reserve(TRADE_BUFFER_SIZE);
+    dirty_buy_levels.reserve(64);
+    dirty_sell_levels.reserve(64);
 
     buy_side_limits.reserve(256);
     sell_side_limits.reserve(256);
     id_to_order.reserve(initial_capacity);
+
+    // Fault the pool pages in now: first-touch page faults on fresh slabs
+    // otherwise land inside the first minutes of matching after a restart.
+    order_pool.prewarm(initial_capacity);
+    level_pool.prewarm(initial_capacity / 16);
 }
 
 // --- Intrusive sorted list helpers ---
@@ -33,6 +51,21 @@ void Book::insert_level_sorted_buy(Level* level) {
         return;
     }
 
+    // Ladder shortcut: for an in-window price the nearest occupied price
+    // above is exactly the list predecessor, because every in-window
+    // level is in the bitmap and anything between the two would have to
+    // be in the window too.
+    PRICE above = buy_ladder.covers(price) ? buy_ladder.nearest_above(price)
+                                           : LadderIndex::NO_PRICE;
+    if (above != LadderIndex::NO_PRICE) {
+        Level* cur = buy_ladder.get(above);
+        level->set_next_level(cur->get_next_level());
+        level->set_prev_level(cur);
+        if (cur->get_next_level()) cur->get_next_level()->set_prev_level(level);
+        cur->set_next_level(level);
+        return;
+    }
+
     // Walk to find insertion point (descending order)
     Level* cur = buy_list_head;
     while (cur->get_next_level() && cur->get_next_level()->get_price() > price) {
@@ -58,6 +91,19 @@ void Book::insert_level_sorted_sell(Level* level) {
         return;
     }
 
+    // Ladder shortcut: same argument as the buy side, with the nearest
+    // occupied price below as the list predecessor in ascending order.
+    PRICE below = sell_ladder.covers(price) ? sell_ladder.nearest_below(price)
+                                            : LadderIndex::NO_PRICE;
+    if (below != LadderIndex::NO_PRICE) {
+        Level* cur = sell_ladder.get(below);
+        level->set_next_level(cur->get_next_level());
+        level->set_prev_level(cur);
+        if (cur->get_next_level()) cur->get_next_level()->set_prev_level(level);
+        cur->set_next_level(level);
+        return;
+    }
+
     // Walk to find insertion point (ascending order)
     Level* cur = sell_list_head;
     while (cur->get_next_level() && cur->get_next_level()->get_price() < price) {
@@ -90,6 +136,137 @@ void Book::remove_level_from_sell_list(Level* level) {
     level->set_next_level(nullptr);
 }
 
+// --- Dirty-level tracking ---
+
+void Book::mark_level_dirty(Level* level, bool is_buy) {
+    // Every mutation path funnels through here, so this is the one place
+    // the version counter needs bumping (before the per-epoch dedup below:
+    // repeat touches of one level are still distinct mutations).
+    ++version_;
+
+    // Any level touch can change or reorder the top of book on that side.
+    if (is_buy) {
+        buy_depth_stale = true;
+    } else {
+        sell_depth_stale = true;
+    }
+
+    // Checksum invalidation is windowed: only touches at or inside the
+    // top-N boundary recorded at the last rebuild can change the top-N
+    // content, so churn deeper in the book leaves the cache valid.
+    if (is_buy ? level->get_price() >= checksum_bid_floor_
+               : level->get_price() <= checksum_ask_ceil_) {
+        checksum_stale_ = true;
+    }
+
+    if (level->get_dirty_epoch() == dirty_epoch) {
+        return; // already recorded this epoch
+    }
+    level->set_dirty_epoch(dirty_epoch);
+    if (is_buy) {
+        dirty_buy_levels.push_back(level->get_price());
+    } else {
+        dirty_sell_levels.push_back(level->get_price());
+    }
+}
+
+void Book::clear_dirty_levels() {
+    dirty_buy_levels.clear();
+    dirty_sell_levels.clear();
+    ++dirty_epoch;
+}
+
+// --- Top-N depth view ---
+
+size_t Book::refresh_depth_cache(bool is_buy) const {
+    auto& cache = is_buy ? buy_depth_cache : sell_depth_cache;
+    Level* l = is_buy ? buy_list_head : sell_list_head;
+
+    size_t count = 0;
+    while (l && count < MAX_DEPTH_VIEW) {
+        if (!l->is_empty()) {
+            cache[count++] = {
+                l->get_price(),
+                l->get_total_volume(),
+                l->get_order_number()
+            };
+        }
+        l = l->get_next_level();
+    }
+    return count;
+}
+
+size_t Book::top_of_book(OrderType side, DepthEntry* out, size_t n) const {
+    const bool is_buy = (side == BUY);
+
+    if (is_buy ? buy_depth_stale : sell_depth_stale) {
+        if (is_buy) {
+            buy_depth_cached = refresh_depth_cache(true);
+            buy_depth_stale = false;
+        } else {
+            sell_depth_cached = refresh_depth_cache(false);
+            sell_depth_stale = false;
+        }
+    }
+
+    const auto& cache = is_buy ? buy_depth_cache : sell_depth_cache;
+    const size_t available = is_buy ? buy_depth_cached : sell_depth_cached;
+    if (n > available) {
+        n = available;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = cache[i];
+    }
+    return n;
+}
+
+// --- Top-of-book checksum ---
+
+uint32_t Book::top_checksum(size_t depth) const {
+    if (depth > BookChecksum::DEPTH) depth = BookChecksum::DEPTH;
+    if (!checksum_stale_ && depth == checksum_depth_cached_) {
+        return top_checksum_cache_;
+    }
+
+    ChecksumLevel bids[BookChecksum::DEPTH];
+    ChecksumLevel asks[BookChecksum::DEPTH];
+    size_t n_bids = 0;
+    size_t n_asks = 0;
+    for (Level* l = buy_list_head; l && n_bids < depth; l = l->get_next_level()) {
+        if (!l->is_empty()) {
+            bids[n_bids++] = {l->get_price(), l->get_total_volume()};
+        }
+    }
+    for (Level* l = sell_list_head; l && n_asks < depth; l = l->get_next_level()) {
+        if (!l->is_empty()) {
+            asks[n_asks++] = {l->get_price(), l->get_total_volume()};
+        }
+    }
+
+    // Record the window boundary for mark_level_dirty: mutations strictly
+    // beyond the Nth level cannot change the checksummed content. A side
+    // with fewer than depth levels has no boundary (any insert matters).
+    checksum_bid_floor_ =
+        (n_bids == depth) ? static_cast<PRICE>(bids[n_bids - 1].price) : 0;
+    checksum_ask_ceil_ = (n_asks == depth)
+                             ? static_cast<PRICE>(asks[n_asks - 1].price)
+                             : std::numeric_limits<PRICE>::max();
+
+    top_checksum_cache_ = BookChecksum::compute(bids, n_bids, asks, n_asks);
+    checksum_depth_cached_ = depth;
+    checksum_stale_ = false;
+    return top_checksum_cache_;
+}
+
+size_t Book::maintain(size_t budget_ops) {
+    // The order index absorbs most cancel churn, so it gets half the
+    // budget; the two level maps split the rest.
+    size_t cleared = id_to_order.maintain(budget_ops / 2);
+    cleared += buy_side_limits.maintain(budget_ops / 4);
+    cleared += sell_side_limits.maintain(budget_ops / 4);
+    return cleared;
+}
+
 // --- Core methods ---
 
 const Trades& Book::place_order(
@@ -100,83 +277,56 @@ const Trades& Book::place_order(
     Volume volume
 ) {
     trade_buffer.clear();
+    place_order(order_id, agent_id, order_type, price, volume,
+                [this](const Trade& t) { trade_buffer.push_back(t); });
+    return trade_buffer;
+}
+
+void Book::set_level(OrderType side, PRICE price, Volume volume) {
+    if (LOB_UNLIKELY(price <= 0)) {
+        return;
+    }
+
+    const bool is_buy = (side == BUY);
+    PriceLevelMap& limits = is_buy ? buy_side_limits : sell_side_limits;
 
-    if (LOB_UNLIKELY(price <= 0 || volume == 0)) {
-        return trade_buffer;
-    }
-
-    Order* order = order_pool.allocate(
-        order_id, agent_id, order_type, price, volume, volume, ACTIVE
-    );
-
-    if (order_type == BUY) {
-        while (best_ask && price >= best_ask->get_price() && !order->is_fulfilled()) {
-            bool level_empty = match_against_level(order, best_ask);
-            if (level_empty) {
-                PRICE empty_price = best_ask->get_price();
-                Level* empty_level = best_ask;
-                // Unlink from sorted list BEFORE deallocation
-                remove_level_from_sell_list(empty_level);
-                sell_side_limits.erase(empty_price);
-                level_pool.deallocate(empty_level);
-                // best_ask (sell_list_head) already updated by remove_level_from_sell_list
-            }
+    if (volume == 0) {
+        auto it = limits.find(price);
+        if (it == limits.end()) {
+            return;
         }
-    } else {
-        while (best_bid && price <= best_bid->get_price() && !order->is_fulfilled()) {
-            bool level_empty = match_against_level(order, best_bid);
-            if (level_empty) {
-                PRICE empty_price = best_bid->get_price();
-                Level* empty_level = best_bid;
-                remove_level_from_buy_list(empty_level);
-                buy_side_limits.erase(empty_price);
-                level_pool.deallocate(empty_level);
-            }
+        Level* level = it->second;
+        mark_level_dirty(level, is_buy);
+
+        // Release any real resting orders (none on a pure L2 book).
+        while (level->get_head()) {
+            Order* order = level->pop_front();
+            id_to_order.erase(order->get_order_id());
+            order_pool.deallocate(order);
         }
-    }
 
-    if (!order->is_fulfilled()) {
-        insert_resting_order(order);
-    } else {
-        order_pool.deallocate(order);
+        if (is_buy) {
+            remove_level_from_buy_list(level);
+        } else {
+            remove_level_from_sell_list(level);
+        }
+        limits.erase(it);
+        (is_buy ? buy_ladder : sell_ladder).erase(price);
+        level_pool.deallocate(level);
+        return;
     }
 
-    return trade_buffer;
-}
+    Level* level = get_or_create_level(price, is_buy);
 
-bool Book::match_against_level(Order* incoming_order, Level* level) {
-    if (LOB_UNLIKELY(!incoming_order || !level || level->is_empty())) {
-        return false;
-    }
-
-    while (level->get_head() && !incoming_order->is_fulfilled()) {
-        Order* resting_order = level->get_head();
-        Volume resting_remaining = resting_order->get_remaining_volume();
-        Volume incoming_remaining = incoming_order->get_remaining_volume();
-        Volume fill_volume = (resting_remaining < incoming_remaining)
-                            ? resting_remaining
-                            : incoming_remaining;
-
-        resting_order->fill(fill_volume);
-        incoming_order->fill(fill_volume);
-        level->decrease_volume(fill_volume);
-
-        trade_buffer.emplace_back(
-            incoming_order->get_order_id(),
-            resting_order->get_order_id(),
-            level->get_price(),
-            fill_volume
-        );
-
-        if (resting_order->is_fulfilled()) {
-            resting_order->set_order_status(FULFILLED);
-            Order* fulfilled_order = level->pop_front();
-            id_to_order.erase(fulfilled_order->get_order_id());
-            order_pool.deallocate(fulfilled_order);
-        }
+    // Drop any real resting orders so the aggregate is authoritative.
+    while (level->get_head()) {
+        Order* order = level->pop_front();
+        id_to_order.erase(order->get_order_id());
+        order_pool.deallocate(order);
     }
 
-    return level->is_empty();
+    level->set_aggregate(volume, 1);
+    mark_level_dirty(level, is_buy);
 }
 
 void Book::delete_order(ID id) {
@@ -196,17 +346,65 @@ void Book::delete_order(ID id) {
     }
 }
 
+void Book::modify_order(ID id, Volume new_volume) {
+    if (new_volume == 0) {
+        delete_order(id);
+        return;
+    }
+
+    auto it = id_to_order.find(id);
+    if (it == id_to_order.end()) {
+        return;
+    }
+
+    Order* order = it->second;
+    if (order->get_order_status() != ACTIVE) {
+        return;
+    }
+
+    const bool is_buy = (order->get_order_type() == BUY);
+    PriceLevelMap& limits = is_buy ? buy_side_limits : sell_side_limits;
+    auto lit = limits.find(order->get_order_price());
+    if (lit == limits.end()) {
+        return;
+    }
+    Level* level = lit->second;
+
+    Volume old_remaining = order->get_remaining_volume();
+    if (new_volume < old_remaining) {
+        // Size decrease keeps queue priority.
+        level->decrease_volume(old_remaining - new_volume);
+        order->amend_remaining_volume(new_volume);
+    } else if (new_volume > old_remaining) {
+        // Size increase loses priority: re-queue at the back of the level.
+        level->erase(order);
+        order->amend_remaining_volume(new_volume);
+        level->push_back(order);
+    } else {
+        return; // unchanged
+    }
+
+    mark_level_dirty(level, is_buy);
+}
+
 void Book::insert_resting_order(Order* order) {
     PRICE price = order->get_order_price();
     bool is_buy = (order->get_order_type() == BUY);
 
     Level* level = get_or_create_level(price, is_buy);
     level->push_back(order);
+    mark_level_dirty(level, is_buy);
 
     id_to_order[order->get_order_id()] = order;
 }
 
 Level* Book::get_or_create_level(PRICE price, bool is_buy) {
+    // Ladder fast path: one direct-indexed load for the dense band.
+    LadderIndex& ladder = is_buy ? buy_ladder : sell_ladder;
+    if (Level* hit = ladder.get(price)) {
+        return hit;
+    }
+
     PriceLevelMap& limits = is_buy ? buy_side_limits : sell_side_limits;
     auto it = limits.find(price);
 
@@ -217,16 +415,41 @@ Level* Book::get_or_create_level(PRICE price, bool is_buy) {
     Level* level = level_pool.allocate(price);
     limits[price] = level;
 
-    // Insert into sorted intrusive list
+    // Insert into sorted intrusive list (before index_level so the
+    // ladder's neighbour queries cannot hit the level itself).
     if (is_buy) {
         insert_level_sorted_buy(level);
     } else {
         insert_level_sorted_sell(level);
     }
+    index_level(level, is_buy);
 
     return level;
 }
 
+void Book::index_level(Level* level, bool is_buy) {
+    LadderIndex& ladder = is_buy ? buy_ladder : sell_ladder;
+    const PRICE price = level->get_price();
+    if (!ladder.covers(price)) {
+        if (!ladder.should_recenter(price)) {
+            return; // far outlier: hash map only
+        }
+        rebuild_ladder(is_buy, price);
+    }
+    ladder.set(price, level);
+}
+
+void Book::rebuild_ladder(bool is_buy, PRICE center) {
+    LadderIndex& ladder = is_buy ? buy_ladder : sell_ladder;
+    ladder.reset(center);
+    for (Level* l = is_buy ? buy_list_head : sell_list_head; l;
+         l = l->get_next_level()) {
+        if (ladder.covers(l->get_price())) {
+            ladder.set(l->get_price(), l);
+        }
+    }
+}
+
 void Book::remove_order_from_level(Order* order, bool is_buy) {
     PRICE price = order->get_order_price();
     PriceLevelMap& limits = is_buy ? buy_side_limits : sell_side_limits;
@@ -237,6 +460,7 @@ void Book::remove_order_from_level(Order* order, bool is_buy) {
     }
 
     Level* level = it->second;
+    mark_level_dirty(level, is_buy);
     level->erase(order);
     order->set_order_status(DELETED);
 
@@ -248,6 +472,7 @@ void Book::remove_order_from_level(Order* order, bool is_buy) {
             remove_level_from_sell_list(level);
         }
         limits.erase(it);
+        (is_buy ? buy_ladder : sell_ladder).erase(price);
         level_pool.deallocate(level);
     }
 }
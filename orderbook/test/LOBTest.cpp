@@ -375,8 +375,406 @@ TEST(BookTest, PoolReuseNoMemoryGrowth) {
     EXPECT_EQ(book.get_resting_orders_count(), 0);
 }
 
+TEST(BookTest, TopOfBookReflectsSortedDepth) {
+    Book book;
+    book.place_order(1, 1, BUY, 100, 500);
+    book.place_order(2, 1, BUY, 102, 300);
+    book.place_order(3, 1, BUY, 101, 200);
+    book.place_order(4, 2, SELL, 105, 400);
+    book.place_order(5, 2, SELL, 104, 100);
+
+    DepthEntry bids[4];
+    size_t n = book.top_of_book(BUY, bids, 4);
+    ASSERT_EQ(n, 3);
+    EXPECT_EQ(bids[0].price, 102);
+    EXPECT_EQ(bids[0].volume, 300);
+    EXPECT_EQ(bids[1].price, 101);
+    EXPECT_EQ(bids[2].price, 100);
+    EXPECT_EQ(bids[2].order_count, 1);
+
+    DepthEntry asks[4];
+    n = book.top_of_book(SELL, asks, 4);
+    ASSERT_EQ(n, 2);
+    EXPECT_EQ(asks[0].price, 104);
+    EXPECT_EQ(asks[1].price, 105);
+}
+
+TEST(BookTest, TopOfBookUpdatesAfterMatchAndCancel) {
+    Book book;
+    book.place_order(1, 1, BUY, 100, 500);
+    book.place_order(2, 1, BUY, 99, 500);
+    book.place_order(3, 2, SELL, 101, 300);
+
+    DepthEntry entries[2];
+    ASSERT_EQ(book.top_of_book(BUY, entries, 2), 2);
+
+    // Sweep the best bid, cancel the other: buy side empties.
+    book.place_order(4, 2, SELL, 100, 500);
+    book.delete_order(2);
+    EXPECT_EQ(book.top_of_book(BUY, entries, 2), 0);
+
+    // Partial fill against the resting ask reduces its cached volume.
+    book.place_order(5, 1, BUY, 101, 100);
+    ASSERT_EQ(book.top_of_book(SELL, entries, 2), 1);
+    EXPECT_EQ(entries[0].price, 101);
+    EXPECT_EQ(entries[0].volume, 200);
+}
+
+TEST(BookTest, TopOfBookTruncatesToRequestedDepth) {
+    Book book;
+    for (ID i = 1; i <= 20; ++i) {
+        book.place_order(i, 1, BUY, static_cast<PRICE>(100 + i), 10);
+    }
+
+    DepthEntry entries[5];
+    size_t n = book.top_of_book(BUY, entries, 5);
+    ASSERT_EQ(n, 5);
+    EXPECT_EQ(entries[0].price, 120);
+    EXPECT_EQ(entries[4].price, 116);
+}
+
+TEST(BookTest, SetLevelCreatesAndUpdatesDepth) {
+    Book book;
+    book.set_level(BUY, 100, 500);
+    book.set_level(BUY, 99, 300);
+    book.set_level(SELL, 101, 400);
+
+    EXPECT_EQ(book.get_best_buy(), 100);
+    EXPECT_EQ(book.get_best_sell(), 101);
+    EXPECT_EQ(book.get_buy_levels_count(), 2);
+    EXPECT_EQ(book.get_resting_orders_count(), 0);
+
+    DepthEntry entries[2];
+    ASSERT_EQ(book.top_of_book(BUY, entries, 2), 2);
+    EXPECT_EQ(entries[0].volume, 500);
+
+    // Replace, don't accumulate.
+    book.set_level(BUY, 100, 250);
+    ASSERT_EQ(book.top_of_book(BUY, entries, 2), 2);
+    EXPECT_EQ(entries[0].volume, 250);
+}
+
+TEST(BookTest, SetLevelZeroVolumeRemovesLevel) {
+    Book book;
+    book.set_level(BUY, 100, 500);
+    book.set_level(BUY, 99, 300);
+
+    book.set_level(BUY, 100, 0);
+    EXPECT_EQ(book.get_best_buy(), 99);
+    EXPECT_EQ(book.get_buy_levels_count(), 1);
+
+    // Removing an absent level is a no-op.
+    book.set_level(SELL, 105, 0);
+    EXPECT_EQ(book.get_sell_levels_count(), 0);
+}
+
+TEST(BookTest, SetLevelAllocatesNoOrders) {
+    Book book;
+    for (PRICE p = 1; p <= 1000; ++p) {
+        book.set_level(BUY, p, 10);
+        book.set_level(SELL, p + 2000, 10);
+    }
+    EXPECT_EQ(book.get_resting_orders_count(), 0);
+    EXPECT_EQ(book.get_buy_levels_count(), 1000);
+    EXPECT_EQ(book.get_sell_levels_count(), 1000);
+}
+
+TEST(BookTest, ModifyOrderDecreaseKeepsPriority) {
+    Book book;
+    book.place_order(1, 1, BUY, 100, 500);
+    book.place_order(2, 1, BUY, 100, 300);
+
+    book.modify_order(1, 200);
+
+    DepthEntry entries[1];
+    ASSERT_EQ(book.top_of_book(BUY, entries, 1), 1);
+    EXPECT_EQ(entries[0].volume, 500); // 200 + 300
+
+    // Order 1 still matches first at its reduced size.
+    const Trades& trades = book.place_order(3, 2, SELL, 100, 200);
+    ASSERT_EQ(trades.size(), 1);
+    EXPECT_EQ(trades[0].get_matched_order(), 1);
+}
+
+TEST(BookTest, ModifyOrderIncreaseLosesPriority) {
+    Book book;
+    book.place_order(1, 1, BUY, 100, 300);
+    book.place_order(2, 1, BUY, 100, 300);
+
+    book.modify_order(1, 600);
+
+    DepthEntry entries[1];
+    ASSERT_EQ(book.top_of_book(BUY, entries, 1), 1);
+    EXPECT_EQ(entries[0].volume, 900);
+
+    // Order 2 now matches first; order 1 was re-queued at the back.
+    const Trades& trades = book.place_order(3, 2, SELL, 100, 300);
+    ASSERT_EQ(trades.size(), 1);
+    EXPECT_EQ(trades[0].get_matched_order(), 2);
+}
+
+TEST(BookTest, ModifyOrderToZeroCancels) {
+    Book book;
+    book.place_order(1, 1, BUY, 100, 500);
+    book.modify_order(1, 0);
+
+    EXPECT_EQ(book.get_buy_levels_count(), 0);
+    EXPECT_EQ(book.get_resting_orders_count(), 0);
+}
+
+TEST(BookTest, ModifyUnknownOrderIsNoOp) {
+    Book book;
+    book.place_order(1, 1, BUY, 100, 500);
+    book.modify_order(42, 100);
+
+    DepthEntry entries[1];
+    ASSERT_EQ(book.top_of_book(BUY, entries, 1), 1);
+    EXPECT_EQ(entries[0].volume, 500);
+}
+
+TEST(BookTest, VersionBumpsOnMutationsOnly) {
+    Book book;
+    const std::uint64_t v0 = book.version();
+
+    book.place_order(1, 1, BUY, 100, 500);
+    const std::uint64_t v1 = book.version();
+    EXPECT_GT(v1, v0);
+
+    // Reads leave the version alone.
+    DepthEntry entries[4];
+    book.top_of_book(BUY, entries, 4);
+    book.get_mid_price();
+    EXPECT_EQ(book.version(), v1);
+
+    book.set_level(SELL, 105, 200);
+    const std::uint64_t v2 = book.version();
+    EXPECT_GT(v2, v1);
+
+    book.delete_order(1);
+    const std::uint64_t v3 = book.version();
+    EXPECT_GT(v3, v2);
+
+    // Unknown-id delete is a no-op and must not signal a change.
+    book.delete_order(42);
+    EXPECT_EQ(book.version(), v3);
+}
+
+TEST(BookTest, SinkOverloadMatchesBufferedTrades) {
+    // Identical books; one crossing order through each flavour.
+    Book buffered, sunk;
+    for (ID id = 1; id <= 3; ++id) {
+        buffered.place_order(id, 1, SELL, 100 + static_cast<PRICE>(id), 50);
+        sunk.place_order(id, 1, SELL, 100 + static_cast<PRICE>(id), 50);
+    }
+
+    const Trades& expected = buffered.place_order(10, 2, BUY, 103, 120);
+
+    std::vector<Trade> collected;
+    sunk.place_order(10, 2, BUY, 103, 120,
+                     [&](const Trade& t) { collected.push_back(t); });
+
+    ASSERT_EQ(collected.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(collected[i].get_matched_order(), expected[i].get_matched_order());
+        EXPECT_EQ(collected[i].get_trade_price(), expected[i].get_trade_price());
+        EXPECT_EQ(collected[i].get_trade_volume(), expected[i].get_trade_volume());
+    }
+    EXPECT_EQ(sunk.get_resting_orders_count(), buffered.get_resting_orders_count());
+    EXPECT_EQ(sunk.get_sell_levels_count(), buffered.get_sell_levels_count());
+}
+
+TEST(BookTest, PlaceOrdersBatchMatchesSequential) {
+    Book sequential, batched;
+
+    const OrderRequest requests[] = {
+        {1, 1, SELL, 101, 50},
+        {2, 1, SELL, 102, 50},
+        {3, 1, BUY, 100, 30},
+        {4, 2, BUY, 101, 80},   // crosses into the resting asks
+        {5, 2, SELL, 100, 20},  // crosses into the resting bid
+        {6, 3, BUY, 99, 10},
+    };
+    const size_t n = sizeof(requests) / sizeof(requests[0]);
+
+    std::vector<Trade> seq_trades, batch_trades;
+    for (size_t i = 0; i < n; ++i) {
+        const OrderRequest& r = requests[i];
+        sequential.place_order(r.order_id, r.agent_id, r.order_type,
+                               r.price, r.volume,
+                               [&](const Trade& t) { seq_trades.push_back(t); });
+    }
+    batched.place_orders(requests, n,
+                         [&](const Trade& t) { batch_trades.push_back(t); });
+
+    ASSERT_EQ(batch_trades.size(), seq_trades.size());
+    for (size_t i = 0; i < seq_trades.size(); ++i) {
+        EXPECT_EQ(batch_trades[i].get_incoming_order(), seq_trades[i].get_incoming_order());
+        EXPECT_EQ(batch_trades[i].get_matched_order(), seq_trades[i].get_matched_order());
+        EXPECT_EQ(batch_trades[i].get_trade_price(), seq_trades[i].get_trade_price());
+        EXPECT_EQ(batch_trades[i].get_trade_volume(), seq_trades[i].get_trade_volume());
+    }
+    EXPECT_EQ(batched.get_resting_orders_count(), sequential.get_resting_orders_count());
+    EXPECT_EQ(batched.get_buy_levels_count(), sequential.get_buy_levels_count());
+    EXPECT_EQ(batched.get_sell_levels_count(), sequential.get_sell_levels_count());
+    EXPECT_EQ(batched.get_buy_prices(), sequential.get_buy_prices());
+    EXPECT_EQ(batched.get_sell_prices(), sequential.get_sell_prices());
+}
+
+// LadderIndex Tests
+
+TEST(LadderIndexTest, NeighbourQueriesUseBitmap) {
+    LadderIndex ladder;
+    ladder.reset(10000);
+    Level a(9990), b(10000), c(10100);
+    ladder.set(9990, &a);
+    ladder.set(10000, &b);
+    ladder.set(10100, &c);
+
+    EXPECT_EQ(ladder.get(10000), &b);
+    EXPECT_EQ(ladder.get(10001), nullptr);
+    EXPECT_EQ(ladder.nearest_above(9990), 10000u);
+    EXPECT_EQ(ladder.nearest_above(10000), 10100u);
+    EXPECT_EQ(ladder.nearest_above(10100), LadderIndex::NO_PRICE);
+    EXPECT_EQ(ladder.nearest_below(10100), 10000u);
+    EXPECT_EQ(ladder.nearest_below(9990), LadderIndex::NO_PRICE);
+
+    ladder.erase(10000);
+    EXPECT_EQ(ladder.get(10000), nullptr);
+    EXPECT_EQ(ladder.nearest_above(9990), 10100u);
+}
+
+TEST(LadderIndexTest, CoverageAndRecenterPolicy) {
+    LadderIndex ladder;
+    ladder.reset(10000);
+    const PRICE base = 10000 - LadderIndex::WINDOW / 2;
+    EXPECT_TRUE(ladder.covers(base));
+    EXPECT_TRUE(ladder.covers(base + LadderIndex::WINDOW - 1));
+    EXPECT_FALSE(ladder.covers(base + LadderIndex::WINDOW));
+
+    // Just beyond an edge slides the window; far outliers do not.
+    EXPECT_TRUE(ladder.should_recenter(base + LadderIndex::WINDOW + 10));
+    EXPECT_FALSE(ladder.should_recenter(base + 3 * LadderIndex::WINDOW));
+}
+
+TEST(BookTest, LadderKeepsLevelsSortedAcrossWindow) {
+    Book book;
+    // Mixed insert order, including prices far enough apart to force the
+    // hash-map fallback and a window recenter.
+    const PRICE prices[] = {10000, 9990, 10050, 9950, 10025,
+                            10000 + 3 * static_cast<PRICE>(LadderIndex::WINDOW),
+                            9910, 10075};
+    ID id = 1;
+    for (PRICE p : prices) {
+        book.place_order(id++, 1, SELL, p, 10);
+    }
+
+    std::vector<PRICE> sorted = book.get_sell_prices();
+    for (size_t i = 1; i < sorted.size(); ++i) {
+        EXPECT_LT(sorted[i - 1], sorted[i]);
+    }
+    EXPECT_EQ(sorted.size(), 8u);
+
+    // Deleting and re-adding inside the band keeps ordering intact.
+    book.set_level(SELL, 10025, 0);
+    book.place_order(id++, 1, SELL, 10030, 10);
+    sorted = book.get_sell_prices();
+    for (size_t i = 1; i < sorted.size(); ++i) {
+        EXPECT_LT(sorted[i - 1], sorted[i]);
+    }
+}
+
 // Main function
 int main(int argc, char **argv) {
 	testing::InitGoogleTest(&argc, argv);
 	return RUN_ALL_TESTS();
 }
+
+TEST(FlatHashMapTest, MaintainClearsTombstonesAndPreservesEntries) {
+    FlatHashMap<ID, uint64_t> map;
+    for (ID id = 1; id <= 1000; ++id) {
+        map[id] = id * 10;
+    }
+    // Cancel-heavy flow: erase every odd id. The compaction piggybacked
+    // on erase already clears some tombstones as it goes.
+    for (ID id = 1; id <= 1000; id += 2) {
+        EXPECT_EQ(map.erase(id), 1u);
+    }
+    EXPECT_EQ(map.size(), 500u);
+
+    // Idle-time maintenance drains whatever tombstones remain.
+    while (map.tombstone_count() > 0) {
+        ASSERT_GT(map.maintain(64), 0u);
+    }
+
+    for (ID id = 1; id <= 1000; ++id) {
+        auto it = map.find(id);
+        if (id % 2 == 0) {
+            ASSERT_NE(it, map.end());
+            EXPECT_EQ(it->second, id * 10);
+        } else {
+            EXPECT_EQ(it, map.end());
+        }
+    }
+}
+
+TEST(FlatHashMapTest, MaintainIsValidAtEveryPartialBudget) {
+    FlatHashMap<ID, uint64_t> map;
+    for (ID id = 1; id <= 200; ++id) {
+        map[id] = id;
+    }
+    for (ID id = 1; id <= 200; id += 3) {
+        map.erase(id);
+    }
+
+    // Tiny budgets stop mid-cluster; lookups must stay correct after
+    // every step.
+    while (map.tombstone_count() > 0) {
+        (void)map.maintain(3);
+        for (ID id = 2; id <= 200; id += 3) {
+            auto it = map.find(id);
+            ASSERT_NE(it, map.end());
+            ASSERT_EQ(it->second, id);
+        }
+    }
+}
+
+TEST(FlatHashMapTest, ErasePiggybackBoundsTombstonesUnderChurn) {
+    FlatHashMap<ID, uint64_t> map;
+    ID next_id = 1;
+    std::vector<ID> live;
+    // 60%+ cancel flow: every order placed is soon cancelled.
+    for (int round = 0; round < 10000; ++round) {
+        map[next_id] = next_id;
+        live.push_back(next_id);
+        ++next_id;
+        if (live.size() > 100) {
+            map.erase(live.front());
+            live.erase(live.begin());
+        }
+    }
+    // The piggybacked compaction keeps the table from filling with
+    // tombstones; without it the count would approach the erase count.
+    EXPECT_LT(map.tombstone_count(), 200u);
+    for (ID id : live) {
+        ASSERT_NE(map.find(id), map.end());
+    }
+}
+
+TEST(BookTest, MaintainCompactsAfterCancelHeavyFlow) {
+    Book book;
+    for (ID id = 1; id <= 500; ++id) {
+        book.place_order(id, 1, BUY, 100 + (id % 50), 10);
+    }
+    for (ID id = 1; id <= 500; ++id) {
+        if (id % 10 != 0) book.delete_order(id);
+    }
+
+    // Drain maintenance until it reports nothing left to do.
+    while (book.maintain(1024) > 0) {
+    }
+
+    EXPECT_EQ(book.get_resting_orders_count(), 50u);
+    for (ID id = 10; id <= 500; id += 10) {
+        EXPECT_EQ(book.get_order_status(id), ACTIVE);
+    }
+}
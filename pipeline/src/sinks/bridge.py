@@ -19,25 +19,29 @@ logger = logging.getLogger(__name__)
 # Quantity conversion: float size -> integer lots
 _QTY_SCALE = int(1e8)
 
+# Price conversion: float price -> integer ticks. Announced per symbol via an
+# EVENT_SYMBOL_CONFIG packet before any data so the C++ side can map ticks
+# back to display prices.
+_PRICE_SCALE = 100
+
+_EVENT_SYMBOL_CONFIG = 5
+
 # MarketDataPacket wire format (must match common/market_data_packet.hpp layout)
-# char symbol[16], uint8 side, uint8 event_type, 6 bytes padding, double price,
-# uint64 quantity, uint64 timestamp_ns, uint64 order_id
-_PACKET_STRUCT = struct.Struct("<16sBB6xdQQQ")
+# char symbol[16], uint8 side, uint8 event_type, 6 bytes padding,
+# uint64 price (pre-scaled ticks), uint64 quantity, uint64 timestamp_ns,
+# uint64 order_id
+_PACKET_STRUCT = struct.Struct("<16sBB6xQQQQ")
 
 _DEFAULT_BRIDGE_SOCKET = "/tmp/quantumflow_bridge.sock"
+_DEFAULT_SHM_RING = "/quantumflow_md_ring"
 
 
-def _native_bridge_sender_cls() -> type[Any] | None:
-    """Try to load the native UDS bridge extension class."""
-    mode = os.getenv("QF_BRIDGE_MODE", "auto").strip().lower()
-    if mode == "python":
-        return None
-
+def _native_bridge_module() -> Any | None:
+    """Try to import the native bridge extension module."""
     module_name = "quantumflow_uds_bridge"
 
     try:
-        module = importlib.import_module(module_name)
-        return getattr(module, "UdsBridgeSender", None)
+        return importlib.import_module(module_name)
     except Exception:
         pass
 
@@ -56,16 +60,43 @@ def _native_bridge_sender_cls() -> type[Any] | None:
         if path_str not in sys.path:
             sys.path.append(path_str)
         try:
-            module = importlib.import_module(module_name)
-            return getattr(module, "UdsBridgeSender", None)
+            return importlib.import_module(module_name)
         except Exception:
             continue
 
+    return None
+
+
+def _native_bridge_sender_cls() -> type[Any] | None:
+    """Try to load the native UDS bridge extension class."""
+    mode = os.getenv("QF_BRIDGE_MODE", "auto").strip().lower()
+    if mode in ("python", "shm"):
+        return None
+
+    module = _native_bridge_module()
+    if module is not None:
+        return getattr(module, "UdsBridgeSender", None)
+
     if mode == "native":
         logger.warning("QF_BRIDGE_MODE=native but native bridge module could not be loaded")
     return None
 
 
+def _shm_bridge_sender_cls() -> type[Any] | None:
+    """Try to load the shared-memory ring sender class."""
+    mode = os.getenv("QF_BRIDGE_MODE", "auto").strip().lower()
+    if mode not in ("auto", "shm"):
+        return None
+
+    module = _native_bridge_module()
+    if module is not None:
+        return getattr(module, "ShmBridgeSender", None)
+
+    if mode == "shm":
+        logger.warning("QF_BRIDGE_MODE=shm but native bridge module could not be loaded")
+    return None
+
+
 class CppBridgeSink(Sink):
     """Sink that pushes market data events to the C++ engine over Unix socket."""
 
@@ -74,16 +105,31 @@ class CppBridgeSink(Sink):
         self._native_sender: Any | None = None
         self._sock: socket.socket | None = None
 
-        sender_cls = _native_bridge_sender_cls()
-        if sender_cls is not None:
+        # Prefer the shared-memory ring (zero syscalls per packet); it is only
+        # available once the C++ engine has created the segment.
+        shm_cls = _shm_bridge_sender_cls()
+        if shm_cls is not None:
+            ring_name = os.getenv("QF_SHM_RING", _DEFAULT_SHM_RING)
             try:
-                self._native_sender = sender_cls(socket_path)
+                self._native_sender = shm_cls(ring_name)
                 logger.info(
-                    "CppBridgeSink using native bridge extension (socket=%s)",
-                    socket_path,
+                    "CppBridgeSink using shared-memory ring (ring=%s)",
+                    ring_name,
                 )
-            except Exception:
-                logger.exception("Failed to init native bridge extension; falling back")
+            except Exception as exc:
+                logger.warning("Shm ring unavailable (%s); falling back to UDS", exc)
+
+        if self._native_sender is None:
+            sender_cls = _native_bridge_sender_cls()
+            if sender_cls is not None:
+                try:
+                    self._native_sender = sender_cls(socket_path)
+                    logger.info(
+                        "CppBridgeSink using native bridge extension (socket=%s)",
+                        socket_path,
+                    )
+                except Exception:
+                    logger.exception("Failed to init native bridge extension; falling back")
 
         if self._native_sender is None:
             self._sock = socket.socket(socket.AF_UNIX, socket.SOCK_DGRAM)
@@ -91,6 +137,7 @@ class CppBridgeSink(Sink):
         self._sent = 0
         self._dropped = 0
         self._warned_missing_socket = False
+        self._configured_symbols: set[str] = set()
 
     @staticmethod
     def _encode_symbol(symbol: str) -> bytes:
@@ -102,7 +149,7 @@ class CppBridgeSink(Sink):
         symbol: str,
         side: int,
         event_type: int,
-        price: float,
+        price: int,
         quantity: int,
         timestamp_ns: int,
         order_id: int = 0,
@@ -111,7 +158,7 @@ class CppBridgeSink(Sink):
             self._encode_symbol(symbol),
             side,
             event_type,
-            float(price),
+            int(price),
             int(quantity),
             int(timestamp_ns),
             int(order_id),
@@ -132,9 +179,34 @@ class CppBridgeSink(Sink):
         except (BlockingIOError, OSError):
             self._dropped += 1
 
+    def _ensure_symbol_config(self, symbol: str, ts_ns: int) -> None:
+        """Announce the symbol's price/qty scales once, before any data."""
+        if symbol in self._configured_symbols:
+            return
+        self._configured_symbols.add(symbol)
+        if self._native_sender is not None:
+            send_config = getattr(self._native_sender, "send_symbol_config", None)
+            if send_config is not None:
+                send_config(
+                    symbol,
+                    price_scale=_PRICE_SCALE,
+                    qty_scale=_QTY_SCALE,
+                    timestamp_ns=ts_ns,
+                )
+            return
+        self._send_packet(
+            symbol=symbol,
+            side=0,
+            event_type=_EVENT_SYMBOL_CONFIG,
+            price=_PRICE_SCALE,
+            quantity=_QTY_SCALE,
+            timestamp_ns=ts_ns,
+        )
+
     async def write(self, event: NormalizedEvent) -> None:
         payload = event.payload
         ts_ns = event.ts_recv_mono_ns
+        self._ensure_symbol_config(event.symbol, ts_ns)
 
         if self._native_sender is not None:
             if isinstance(payload, BookPayload):
@@ -144,6 +216,7 @@ class CppBridgeSink(Sink):
                     payload.asks,
                     ts_ns,
                     _QTY_SCALE,
+                    _PRICE_SCALE,
                 )
                 return
             if isinstance(payload, TradePayload):
@@ -156,6 +229,7 @@ class CppBridgeSink(Sink):
                     ts_ns,
                     0,
                     _QTY_SCALE,
+                    _PRICE_SCALE,
                 )
                 return
 
@@ -166,7 +240,7 @@ class CppBridgeSink(Sink):
                     symbol=event.symbol,
                     side=0,  # buy
                     event_type=0,  # book_level
-                    price=level.price,
+                    price=int(round(level.price * _PRICE_SCALE)),
                     quantity=int(level.size * _QTY_SCALE),
                     timestamp_ns=ts_ns,
                 )
@@ -176,7 +250,7 @@ class CppBridgeSink(Sink):
                     symbol=event.symbol,
                     side=1,  # sell
                     event_type=0,  # book_level
-                    price=level.price,
+                    price=int(round(level.price * _PRICE_SCALE)),
                     quantity=int(level.size * _QTY_SCALE),
                     timestamp_ns=ts_ns,
                 )
@@ -187,7 +261,7 @@ class CppBridgeSink(Sink):
                 symbol=event.symbol,
                 side=side,
                 event_type=1,  # trade
-                price=payload.price,
+                price=int(round(payload.price * _PRICE_SCALE)),
                 quantity=int(payload.size * _QTY_SCALE),
                 timestamp_ns=ts_ns,
             )
@@ -21,7 +21,7 @@ public:
     void set_perp_price(double price) { perp_price_ = price; }
 
     Signal evaluate(const BookSnapshot&,
-                    const std::vector<TradeInfo>&) override {
+                    const TradeView&) override {
         if (funding_rate_ > threshold_)
             return Signal::LONG_SPOT_SHORT_PERP;
 
@@ -32,7 +32,7 @@ public:
     }
 
     double confidence(const BookSnapshot&,
-                      const std::vector<TradeInfo>&,
+                      const TradeView&,
                       Signal signal) const override {
         if (signal == Signal::NEUTRAL) return 0.0;
 
@@ -18,7 +18,7 @@ public:
     }
 
     Signal evaluate(const BookSnapshot& snapshot,
-                    const std::vector<TradeInfo>&) override {
+                    const TradeView&) override {
         if (snapshot.mid_price <= 0.0) return Signal::NEUTRAL;
 
         price_history_.push_back(snapshot.mid_price);
@@ -35,7 +35,7 @@ public:
     }
 
     double confidence(const BookSnapshot&,
-                      const std::vector<TradeInfo>&,
+                      const TradeView&,
                       Signal signal) const override {
         if (signal == Signal::NEUTRAL || price_history_.size() < 2) return 0.0;
 
@@ -19,6 +19,35 @@ public:
         return n;
     }
 
+    /// Declare the two legs of the pair. With a pair set, the strategy
+    /// becomes multi-symbol under StrategyScheduler: evaluation waits
+    /// until both legs' snapshots are staged for the tick, and the
+    /// spread updates from their mid prices via observe(). Without a
+    /// pair it behaves as before (prices fed through update_prices).
+    void set_pair(std::string leg1, std::string leg2) {
+        depends_ = {std::move(leg1), std::move(leg2)};
+        have_leg1_ = have_leg2_ = false;
+    }
+
+    const std::vector<std::string>& depends_on() const override {
+        return depends_;
+    }
+
+    void observe(const BookSnapshot& snapshot) override {
+        if (depends_.size() != 2) return;
+        if (snapshot.symbol == depends_[0]) {
+            leg1_mid_ = snapshot.mid_price;
+            have_leg1_ = true;
+        } else if (snapshot.symbol == depends_[1]) {
+            leg2_mid_ = snapshot.mid_price;
+            have_leg2_ = true;
+        }
+        if (have_leg1_ && have_leg2_) {
+            update_prices(leg1_mid_, leg2_mid_);
+            have_leg1_ = have_leg2_ = false;
+        }
+    }
+
     void update_prices(double price1, double price2) {
         price1_ = price1;
         price2_ = price2;
@@ -29,7 +58,7 @@ public:
     }
 
     Signal evaluate(const BookSnapshot&,
-                    const std::vector<TradeInfo>&) override {
+                    const TradeView&) override {
         double z_score = 0.0;
         if (!compute_z_score(z_score)) return Signal::NEUTRAL;
 
@@ -39,7 +68,7 @@ public:
     }
 
     double confidence(const BookSnapshot&,
-                      const std::vector<TradeInfo>&,
+                      const TradeView&,
                       Signal signal) const override {
         if (signal == Signal::NEUTRAL) return 0.0;
 
@@ -55,6 +84,8 @@ public:
         spread_history_.clear();
         price1_ = 0.0;
         price2_ = 0.0;
+        have_leg1_ = false;
+        have_leg2_ = false;
     }
 
 private:
@@ -84,6 +115,12 @@ private:
     double price1_ = 0.0;
     double price2_ = 0.0;
     std::deque<double> spread_history_;
+
+    std::vector<std::string> depends_;
+    double leg1_mid_ = 0.0;
+    double leg2_mid_ = 0.0;
+    bool have_leg1_ = false;
+    bool have_leg2_ = false;
 };
 
 } // namespace quantumflow
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "common/rolling_stats.hpp"
 #include "strategies/strategy_base.hpp"
 #include <cmath>
 #include <algorithm>
@@ -8,10 +9,17 @@ namespace quantumflow {
 
 class LiquidityDetector : public Strategy {
 public:
+    /// stats_window sizes the rolling count window declared with the engine;
+    /// it must cover at least as many trades as the view passed to evaluate()
+    /// so the window aggregates upper-bound every per-level cluster. That
+    /// superset property only holds while the engine serves one symbol —
+    /// the window is fed engine-wide, the view per symbol — so the O(1)
+    /// gate disables itself once evaluate() sees a second symbol.
     explicit LiquidityDetector(int min_fills = 5, uint64_t min_volume = 100,
-                               double price_tolerance = 0.01)
+                               double price_tolerance = 0.01,
+                               size_t stats_window = 1024)
         : min_fills_(min_fills), min_volume_(min_volume),
-          price_tolerance_(price_tolerance) {}
+          price_tolerance_(price_tolerance), stats_window_(stats_window) {}
 
     const std::string& name() const override {
         static const std::string n = "LiquidityDetector";
@@ -19,7 +27,14 @@ public:
     }
 
     Signal evaluate(const BookSnapshot& snapshot,
-                    const std::vector<TradeInfo>& recent_trades) override {
+                    const TradeView& recent_trades) override {
+        if (!multi_symbol_) {
+            if (seen_symbol_.empty()) {
+                seen_symbol_ = snapshot.symbol;
+            } else if (seen_symbol_ != snapshot.symbol) {
+                multi_symbol_ = true;
+            }
+        }
         if (recent_trades.empty() || snapshot.bids.empty())
             return Signal::NEUTRAL;
 
@@ -34,7 +49,7 @@ public:
     }
 
     double confidence(const BookSnapshot& snapshot,
-                      const std::vector<TradeInfo>& recent_trades,
+                      const TradeView& recent_trades,
                       Signal signal) const override {
         if (signal == Signal::NEUTRAL || recent_trades.empty() || snapshot.bids.empty())
             return 0.0;
@@ -50,13 +65,43 @@ public:
         return clamp_confidence(side_score * (1.0 - opp_score));
     }
 
+    void declare_windows(RollingTradeStats& stats) override {
+        stats_ = &stats;
+        window_ = stats.count_window(stats_window_);
+    }
+
 private:
     int min_fills_;
     uint64_t min_volume_;
     double price_tolerance_;
+    size_t stats_window_;
+    const RollingTradeStats* stats_ = nullptr;
+    RollingTradeStats::WindowId window_ = 0;
+    std::string seen_symbol_;
+    bool multi_symbol_ = false;
 
-    double iceberg_strength(const std::vector<TradeInfo>& trades,
+    double iceberg_strength(const TradeView& trades,
                             double price_level) const {
+        if (stats_ != nullptr && !multi_symbol_) {
+            // Single symbol only: the engine-wide window is then a superset
+            // of the per-symbol view, so its aggregates bound every
+            // per-level cluster: too few trades, too little volume, or a
+            // price range clear of the level all rule an iceberg out in
+            // O(1). Any strength below 1.0 is equivalent downstream (both
+            // the signal test and clamp_confidence(x - 1.0) flatten it), so
+            // returning 0.0 here preserves behaviour exactly. With several
+            // symbols the superset breaks — another symbol's trades can
+            // evict this one's from the bounded window — so the gate is
+            // skipped and only the exact scan below decides.
+            const RollingWindowStats& win = stats_->window(window_);
+            if (win.count() < static_cast<size_t>(std::max(1, min_fills_)) ||
+                win.volume() < std::max<uint64_t>(1, min_volume_))
+                return 0.0;
+            if (win.min_price() > price_level + price_tolerance_ ||
+                win.max_price() < price_level - price_tolerance_)
+                return 0.0;
+        }
+
         int fill_count = 0;
         uint64_t total_volume = 0;
 
@@ -17,7 +17,7 @@ public:
     }
 
     Signal evaluate(const BookSnapshot& snapshot,
-                    const std::vector<TradeInfo>&) override {
+                    const TradeView&) override {
         if (snapshot.mid_price <= 0.0) return Signal::NEUTRAL;
 
         double inventory_ratio = inventory_ratio_abs_signed();
@@ -28,7 +28,7 @@ public:
     }
 
     double confidence(const BookSnapshot&,
-                      const std::vector<TradeInfo>&,
+                      const TradeView&,
                       Signal signal) const override {
         if (signal == Signal::NEUTRAL) return 0.0;
 
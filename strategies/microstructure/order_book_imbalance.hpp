@@ -17,7 +17,7 @@ public:
     }
 
     Signal evaluate(const BookSnapshot& snapshot,
-                    const std::vector<TradeInfo>&) override {
+                    const TradeView&) override {
         double imbalance = compute_imbalance(snapshot);
 
         if (imbalance > threshold_) return Signal::BUY;
@@ -26,7 +26,7 @@ public:
     }
 
     double confidence(const BookSnapshot& snapshot,
-                      const std::vector<TradeInfo>&,
+                      const TradeView&,
                       Signal signal) const override {
         if (signal == Signal::NEUTRAL) return 0.0;
 
@@ -38,21 +38,11 @@ public:
 
 private:
     double compute_imbalance(const BookSnapshot& snapshot) const {
-        double bid_volume = 0.0;
-        double ask_volume = 0.0;
-
-        size_t bid_count = std::min(top_n_, snapshot.bids.size());
-        size_t ask_count = std::min(top_n_, snapshot.asks.size());
-
-        for (size_t i = 0; i < bid_count; ++i)
-            bid_volume += static_cast<double>(snapshot.bids[i].quantity);
-        for (size_t i = 0; i < ask_count; ++i)
-            ask_volume += static_cast<double>(snapshot.asks[i].quantity);
-
-        double total = bid_volume + ask_volume;
-        if (total < 1e-9) return 0.0;
-
-        return (bid_volume - ask_volume) / total;
+        const BookSideSoA& bids = snapshot.bids_soa();
+        const BookSideSoA& asks = snapshot.asks_soa();
+        return features::weighted_imbalance(
+            bids.volumes.data(), std::min(top_n_, bids.size()),
+            asks.volumes.data(), std::min(top_n_, asks.size()));
     }
 
     size_t top_n_;
@@ -30,7 +30,7 @@ public:
     }
 
     Signal evaluate(const BookSnapshot& snapshot,
-                    const std::vector<TradeInfo>&) override {
+                    const TradeView&) override {
         (void)snapshot;
         if (total_quantity_ == 0 || executed_quantity_ >= total_quantity_)
             return Signal::NEUTRAL;
@@ -44,7 +44,7 @@ public:
     }
 
     double confidence(const BookSnapshot&,
-                      const std::vector<TradeInfo>&,
+                      const TradeView&,
                       Signal signal) const override {
         if (signal != Signal::BUY || total_quantity_ == 0 || executed_quantity_ >= total_quantity_)
             return 0.0;
@@ -75,9 +75,8 @@ private:
         if (current_slice >= volume_profile_.size())
             return false;
 
-        double target_fraction = 0.0;
-        for (size_t i = 0; i <= current_slice; ++i)
-            target_fraction += volume_profile_[i];
+        const double target_fraction =
+            features::sum(volume_profile_.data(), current_slice + 1);
 
         out_target_qty = static_cast<uint64_t>(
             static_cast<double>(total_quantity_) * target_fraction);
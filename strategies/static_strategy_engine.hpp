@@ -0,0 +1,135 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <string>
+#include <tuple>
+
+#include "common/rolling_stats.hpp"
+#include "common/signal_history.hpp"
+#include "strategies/strategy_base.hpp"
+
+namespace quantumflow {
+
+/// Compile-time counterpart of StrategyEngine for strategy sets known at
+/// build time. Strategies live by value in a tuple and every per-tick call
+/// is qualified with the concrete type, so evaluate()/confidence() dispatch
+/// statically and can inline; latest signals sit in a fixed array indexed
+/// by the strategy's position in the pack instead of a map keyed by name.
+/// The dynamic StrategyEngine stays for plugin-style registration.
+template <typename... Strategies>
+class StaticStrategyEngine {
+public:
+    static constexpr size_t STRATEGY_COUNT = sizeof...(Strategies);
+    static_assert(STRATEGY_COUNT > 0, "engine needs at least one strategy");
+
+    using SignalArray = std::array<StrategySignal, STRATEGY_COUNT>;
+
+    StaticStrategyEngine() {
+        std::apply(
+            [&](auto&... strat) { (declare_windows_one(strat, trade_stats_), ...); },
+            strategies_);
+    }
+
+    /// Run all strategies against the given snapshot. Returns the latest
+    /// signal array, refreshed in place (no per-tick allocation).
+    const SignalArray& evaluate(const BookSnapshot& snapshot,
+                                const TradeView& recent_trades) {
+        const uint64_t now_ns = static_cast<uint64_t>(
+            std::chrono::steady_clock::now().time_since_epoch().count());
+        trade_stats_.advance(now_ns);
+
+        size_t index = 0;
+        std::apply(
+            [&](auto&... strat) {
+                ((evaluate_one(strat, snapshot, recent_trades, now_ns,
+                               latest_signals_[index]),
+                  histories_[index].record(latest_signals_[index].signal,
+                                           latest_signals_[index].confidence,
+                                           now_ns),
+                  ++index),
+                 ...);
+            },
+            strategies_);
+        return latest_signals_;
+    }
+
+    /// Notify all strategies of a new trade.
+    void on_trade(const TradeInfo& trade) {
+        trade_stats_.on_trade(trade);
+        std::apply(
+            [&](auto&... strat) { (on_trade_one(strat, trade), ...); },
+            strategies_);
+    }
+
+    /// Get the latest signal for a given strategy name.
+    const StrategySignal* latest_signal(const std::string& strategy_name) const {
+        for (const auto& sig : latest_signals_) {
+            if (sig.strategy_name == strategy_name) return &sig;
+        }
+        return nullptr;
+    }
+
+    /// Get all latest signals, indexed by strategy position.
+    const SignalArray& all_signals() const { return latest_signals_; }
+
+    /// Per-strategy signal transition history, indexed like all_signals().
+    const SignalHistoryRing& history(size_t index) const {
+        return histories_[index];
+    }
+
+    /// History lookup by strategy name; nullptr until the strategy has
+    /// produced its first signal (the name is only known after that).
+    const SignalHistoryRing* history(const std::string& strategy_name) const {
+        for (size_t i = 0; i < STRATEGY_COUNT; ++i) {
+            if (latest_signals_[i].strategy_name == strategy_name) {
+                return &histories_[i];
+            }
+        }
+        return nullptr;
+    }
+
+    constexpr size_t strategy_count() const { return STRATEGY_COUNT; }
+
+    /// Rolling trade statistics shared by the strategy pack, updated
+    /// incrementally from on_trade().
+    const RollingTradeStats& trade_stats() const { return trade_stats_; }
+
+    /// Direct access to a strategy by type (e.g. for configuration).
+    template <typename S>
+    S& get() { return std::get<S>(strategies_); }
+
+private:
+    template <typename S>
+    static void evaluate_one(S& strat, const BookSnapshot& snapshot,
+                             const TradeView& recent_trades, uint64_t now_ns,
+                             StrategySignal& out) {
+        // Qualified calls bypass the vtable even though Strategy's methods
+        // are virtual.
+        Signal sig = strat.S::evaluate(snapshot, recent_trades);
+        out.strategy_name = strat.S::name();
+        out.symbol = snapshot.symbol;
+        out.signal = sig;
+        out.confidence = std::clamp(
+            strat.S::confidence(snapshot, recent_trades, sig), 0.0, 1.0);
+        out.timestamp_ns = now_ns;
+    }
+
+    template <typename S>
+    static void on_trade_one(S& strat, const TradeInfo& trade) {
+        strat.S::on_trade(trade);
+    }
+
+    template <typename S>
+    static void declare_windows_one(S& strat, RollingTradeStats& stats) {
+        strat.S::declare_windows(stats);
+    }
+
+    std::tuple<Strategies...> strategies_;
+    SignalArray latest_signals_{};
+    std::array<SignalHistoryRing, STRATEGY_COUNT> histories_{};
+    RollingTradeStats trade_stats_;
+};
+
+} // namespace quantumflow
@@ -1,7 +1,44 @@
 #include "strategies/strategy_base.hpp"
 
+#include <algorithm>
+
 namespace quantumflow {
 
+namespace {
+
+/// Apply one side's dirty prices to the sorted snapshot side. cmp is the
+/// side's sort order: bids descend, asks ascend.
+template <typename Cmp>
+void patch_side(std::vector<PriceLevel>& side,
+                const std::vector<PRICE>& dirty,
+                PriceLevelMap& limits,
+                const PriceConverter& converter,
+                Cmp cmp) {
+    for (PRICE p : dirty) {
+        const double external = converter.to_external(p);
+        auto pos = std::lower_bound(side.begin(), side.end(), external, cmp);
+        const bool present = pos != side.end() && pos->price == external;
+
+        auto it = limits.find(p);
+        if (it != limits.end() && !it->second->is_empty()) {
+            PriceLevel lvl{
+                external,
+                it->second->get_total_volume(),
+                it->second->get_order_number()
+            };
+            if (present) {
+                *pos = lvl;
+            } else {
+                side.insert(pos, lvl);
+            }
+        } else if (present) {
+            side.erase(pos);
+        }
+    }
+}
+
+} // namespace
+
 BookSnapshot BookSnapshot::from_book(const Book& book, const std::string& sym,
                                      const PriceConverter& converter) {
     BookSnapshot snap;
@@ -50,7 +87,50 @@ BookSnapshot BookSnapshot::from_book(const Book& book, const std::string& sym,
                          ? converter.to_external(static_cast<PRICE>(book.get_mid_price()))
                          : 0.0;
 
+    // A full rebuild resolves all outstanding changes.
+    const_cast<Book&>(book).clear_dirty_levels();
+
+    snap.invalidate_soa();
     return snap;
 }
 
+void BookSnapshot::update_from_book(Book& book, const PriceConverter& converter) {
+    if (book.has_dirty_levels()) {
+        patch_side(bids, book.get_dirty_buy_levels(), book.get_buy_limits(), converter,
+                   [](const PriceLevel& lvl, double price) { return lvl.price > price; });
+        patch_side(asks, book.get_dirty_sell_levels(), book.get_sell_limits(), converter,
+                   [](const PriceLevel& lvl, double price) { return lvl.price < price; });
+        book.clear_dirty_levels();
+        invalidate_soa();
+    }
+
+    best_bid = book.get_buy_levels_count() > 0
+                   ? converter.to_external(book.get_best_buy())
+                   : 0.0;
+    best_ask = book.get_sell_levels_count() > 0
+                   ? converter.to_external(book.get_best_sell())
+                   : 0.0;
+    mid_price = book.get_mid_price() > 0
+                    ? converter.to_external(static_cast<PRICE>(book.get_mid_price()))
+                    : 0.0;
+}
+
+const BookSideSoA& BookSnapshot::bids_soa() const {
+    if (!soa_valid_) {
+        bids_soa_.assign(bids);
+        asks_soa_.assign(asks);
+        soa_valid_ = true;
+    }
+    return bids_soa_;
+}
+
+const BookSideSoA& BookSnapshot::asks_soa() const {
+    if (!soa_valid_) {
+        bids_soa_.assign(bids);
+        asks_soa_.assign(asks);
+        soa_valid_ = true;
+    }
+    return asks_soa_;
+}
+
 } // namespace quantumflow
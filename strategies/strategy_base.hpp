@@ -5,10 +5,14 @@
 #include <cstdint>
 #include "common/signal_types.hpp"
 #include "common/price_converter.hpp"
+#include "common/trade_ring.hpp"
+#include "common/book_features.hpp"
 #include "LOB/Book.h"
 
 namespace quantumflow {
 
+class RollingTradeStats;
+
 inline double clamp_confidence(double v) {
     if (v < 0.0) return 0.0;
     if (v > 1.0) return 1.0;
@@ -32,13 +36,23 @@ struct BookSnapshot {
 
     static BookSnapshot from_book(const Book& book, const std::string& symbol,
                                   const PriceConverter& converter);
-};
 
-struct TradeInfo {
-    double price;
-    uint64_t quantity;
-    uint8_t side;
-    uint64_t timestamp_ns;
+    /// Patch this snapshot in place from the book's dirty levels, so
+    /// steady-state cost is proportional to churn rather than book depth.
+    /// Both from_book and update_from_book consume the dirty set.
+    void update_from_book(Book& book, const PriceConverter& converter);
+
+    /// Lazily-built SoA mirrors of bids/asks for the vectorized feature
+    /// kernels; rebuilt on first access after from_book/update_from_book.
+    /// Callers mutating bids/asks directly must call invalidate_soa().
+    const BookSideSoA& bids_soa() const;
+    const BookSideSoA& asks_soa() const;
+    void invalidate_soa() { soa_valid_ = false; }
+
+private:
+    mutable BookSideSoA bids_soa_;
+    mutable BookSideSoA asks_soa_;
+    mutable bool soa_valid_ = false;
 };
 
 class Strategy {
@@ -46,15 +60,38 @@ public:
     virtual ~Strategy() = default;
     virtual const std::string& name() const = 0;
     virtual Signal evaluate(const BookSnapshot& snapshot,
-                            const std::vector<TradeInfo>& recent_trades) = 0;
+                            const TradeView& recent_trades) = 0;
     virtual double confidence(const BookSnapshot& snapshot,
-                              const std::vector<TradeInfo>& recent_trades,
+                              const TradeView& recent_trades,
                               Signal signal) const {
         (void)snapshot;
         (void)recent_trades;
         return signal == Signal::NEUTRAL ? 0.0 : 0.5;
     }
     virtual void on_trade(const TradeInfo& trade) { (void)trade; }
+
+    /// Called once when the strategy is registered with an engine. Strategies
+    /// that consume trade-driven statistics declare their rolling windows
+    /// here (common/rolling_stats.hpp) and may keep the reference, so
+    /// evaluate() reads O(1) precomputed aggregates instead of re-scanning
+    /// the trade view.
+    virtual void declare_windows(RollingTradeStats& stats) { (void)stats; }
+
+    /// Symbols this strategy needs per tick beyond the snapshot it is
+    /// evaluated against. Empty (the default) marks a single-symbol
+    /// strategy: it runs once per submitted snapshot. A non-empty list
+    /// makes the scheduler defer evaluation until every listed symbol's
+    /// snapshot has been staged for the tick, delivering each through
+    /// observe() first (in list order, on the submitting thread).
+    virtual const std::vector<std::string>& depends_on() const {
+        static const std::vector<std::string> none;
+        return none;
+    }
+
+    /// Dependency snapshot delivery for multi-symbol strategies; called
+    /// once per depends_on() entry before evaluate() for the tick.
+    virtual void observe(const BookSnapshot& snapshot) { (void)snapshot; }
+
     virtual void reset() {}
 };
 
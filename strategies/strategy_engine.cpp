@@ -5,18 +5,20 @@
 namespace quantumflow {
 
 void StrategyEngine::add_strategy(std::unique_ptr<Strategy> strategy) {
+    strategy->declare_windows(trade_stats_);
     strategies_.push_back(std::move(strategy));
 }
 
 std::vector<StrategySignal> StrategyEngine::evaluate(
     const BookSnapshot& snapshot,
-    const std::vector<TradeInfo>& recent_trades
+    const TradeView& recent_trades
 ) {
     std::vector<StrategySignal> signals;
     signals.reserve(strategies_.size());
 
     uint64_t now_ns = static_cast<uint64_t>(
         std::chrono::steady_clock::now().time_since_epoch().count());
+    trade_stats_.advance(now_ns);
 
     for (auto& strat : strategies_) {
         Signal sig = strat->evaluate(snapshot, recent_trades);
@@ -30,12 +32,15 @@ std::vector<StrategySignal> StrategyEngine::evaluate(
         ss.timestamp_ns = now_ns;
 
         latest_signals_[ss.strategy_name] = ss;
+        histories_[ss.strategy_name].record(ss.signal, ss.confidence,
+                                            ss.timestamp_ns);
         signals.push_back(std::move(ss));
     }
     return signals;
 }
 
 void StrategyEngine::on_trade(const TradeInfo& trade) {
+    trade_stats_.on_trade(trade);
     for (auto& strat : strategies_) {
         strat->on_trade(trade);
     }
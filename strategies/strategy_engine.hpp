@@ -4,6 +4,8 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include "common/rolling_stats.hpp"
+#include "common/signal_history.hpp"
 #include "strategies/strategy_base.hpp"
 
 namespace quantumflow {
@@ -14,7 +16,7 @@ public:
 
     /// Run all strategies against the given snapshot and return signals.
     std::vector<StrategySignal> evaluate(const BookSnapshot& snapshot,
-                                         const std::vector<TradeInfo>& recent_trades);
+                                         const TradeView& recent_trades);
 
     /// Notify all strategies of a new trade.
     void on_trade(const TradeInfo& trade);
@@ -29,9 +31,35 @@ public:
 
     size_t strategy_count() const { return strategies_.size(); }
 
+    /// Per-strategy signal transition history (see SignalHistoryRing):
+    /// populated by evaluate / store_signal whenever a strategy's signal
+    /// or confidence bucket moved. nullptr until the strategy has
+    /// produced its first signal.
+    const SignalHistoryRing* history(const std::string& strategy_name) const {
+        auto it = histories_.find(strategy_name);
+        return it != histories_.end() ? &it->second : nullptr;
+    }
+
+    /// Rolling trade statistics shared by the registered strategies,
+    /// updated incrementally from on_trade().
+    const RollingTradeStats& trade_stats() const { return trade_stats_; }
+
+    /// Scheduler support (strategies/strategy_scheduler.hpp): the
+    /// scheduler evaluates strategies on its workers and publishes the
+    /// gathered signals here from the tick's end, single-threaded.
+    const std::vector<std::unique_ptr<Strategy>>& strategies() { return strategies_; }
+    void store_signal(const StrategySignal& signal) {
+        latest_signals_[signal.strategy_name] = signal;
+        histories_[signal.strategy_name].record(signal.signal, signal.confidence,
+                                                signal.timestamp_ns);
+    }
+    void advance_trade_stats(uint64_t now_ns) { trade_stats_.advance(now_ns); }
+
 private:
     std::vector<std::unique_ptr<Strategy>> strategies_;
     std::unordered_map<std::string, StrategySignal> latest_signals_;
+    std::unordered_map<std::string, SignalHistoryRing> histories_;
+    RollingTradeStats trade_stats_;
 };
 
 } // namespace quantumflow
@@ -0,0 +1,234 @@
+#include "strategies/strategy_scheduler.hpp"
+
+#include <algorithm>
+
+namespace quantumflow {
+
+// --- WorkDeque ---
+
+bool StrategyScheduler::WorkDeque::push(const Task& task) {
+    const int64_t b = bottom_.load(std::memory_order_relaxed);
+    const int64_t t = top_.load(std::memory_order_acquire);
+    if (b - t >= static_cast<int64_t>(CAPACITY)) {
+        return false; // full
+    }
+    buffer_[static_cast<size_t>(b) & (CAPACITY - 1)] = task;
+    bottom_.store(b + 1, std::memory_order_release);
+    return true;
+}
+
+bool StrategyScheduler::WorkDeque::steal(Task& task) {
+    int64_t t = top_.load(std::memory_order_acquire);
+    const int64_t b = bottom_.load(std::memory_order_acquire);
+    if (t >= b) {
+        return false; // empty
+    }
+    // The slot at top_ was fully written before bottom_ advanced past it
+    // (release store in push) and bottom_ never retreats, so the copy is
+    // safe; the CAS settles races between concurrent stealers.
+    task = buffer_[static_cast<size_t>(t) & (CAPACITY - 1)];
+    return top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed);
+}
+
+// --- StrategyScheduler ---
+
+StrategyScheduler::StrategyScheduler(size_t worker_count) {
+    if (worker_count == 0) {
+        const unsigned hw = std::thread::hardware_concurrency();
+        worker_count = hw > 1 ? hw - 1 : 1;
+    }
+    workers_.reserve(worker_count);
+    for (size_t i = 0; i < worker_count; ++i) {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+}
+
+StrategyScheduler::~StrategyScheduler() { stop(); }
+
+void StrategyScheduler::start() {
+    if (running_.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    for (size_t i = 0; i < workers_.size(); ++i) {
+        workers_[i]->thread = std::thread([this, i] { worker_loop(i); });
+    }
+}
+
+void StrategyScheduler::stop() {
+    if (!running_.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+    for (auto& w : workers_) {
+        if (w->thread.joinable()) {
+            w->thread.join();
+        }
+    }
+}
+
+void StrategyScheduler::begin_tick(StrategyEngine& engine, uint64_t now_ns) {
+    engine_ = &engine;
+    tick_ns_ = now_ns;
+    engine.advance_trade_stats(now_ns);
+
+    caller_staged_.clear();
+    staged_snapshots_.clear();
+    const size_t n = engine.strategies().size();
+    if (pending_.size() < n) {
+        pending_.resize(n);
+    }
+    for (auto& items : pending_) {
+        items.clear();
+    }
+    dependent_staged_.assign(n, false);
+    for (auto& w : workers_) {
+        w->staged.clear();
+    }
+}
+
+void StrategyScheduler::submit(const BookSnapshot& snapshot,
+                               const TradeView& trades) {
+    staged_snapshots_[snapshot.symbol] = &snapshot;
+
+    const auto& strategies = engine_->strategies();
+    for (size_t i = 0; i < strategies.size(); ++i) {
+        Strategy* strat = strategies[i].get();
+        const auto& deps = strat->depends_on();
+        if (deps.empty()) {
+            pending_[i].push_back(WorkItem{&snapshot, &trades});
+            continue;
+        }
+        if (dependent_staged_[i]) {
+            continue;
+        }
+        // Multi-symbol strategy: wait for the full dependency set, then
+        // deliver the staged snapshots sequentially (observe runs on this
+        // thread, so the strategy needs no internal locking) and stage
+        // the evaluate item against the first dependency's book.
+        bool ready = true;
+        for (const auto& sym : deps) {
+            if (staged_snapshots_.find(sym) == staged_snapshots_.end()) {
+                ready = false;
+                break;
+            }
+        }
+        if (!ready) {
+            continue;
+        }
+        for (const auto& sym : deps) {
+            strat->observe(*staged_snapshots_[sym]);
+        }
+        dependent_staged_[i] = true;
+        pending_[i].push_back(WorkItem{staged_snapshots_[deps.front()], &trades});
+    }
+}
+
+std::vector<StrategySignal> StrategyScheduler::end_tick() {
+    // Enqueue one task per strategy holding everything staged for it: a
+    // strategy instance must never evaluate on two workers at once, so
+    // the instance is the unit of parallelism. pending_ is not touched
+    // again this tick, so the item pointers stay valid.
+    const auto& strategies = engine_->strategies();
+    for (size_t i = 0; i < strategies.size(); ++i) {
+        if (pending_[i].empty()) {
+            continue;
+        }
+        enqueue(Task{strategies[i].get(), pending_[i].data(), pending_[i].size()});
+    }
+
+    // Help drain until every enqueued task has finished; the submitting
+    // thread steals alongside the workers rather than blocking idle.
+    Task task;
+    while (tasks_pending_.load(std::memory_order_acquire) > 0) {
+        if (try_steal(workers_.size(), task)) {
+            run_task(task, caller_staged_);
+            tasks_pending_.fetch_sub(1, std::memory_order_release);
+        } else {
+            cpu_pause();
+        }
+    }
+
+    // All tasks done (acquire above): merge the per-worker staging into
+    // the engine's signal store single-threaded, no lock needed.
+    std::vector<StrategySignal> signals;
+    signals.reserve(caller_staged_.size() + workers_.size());
+    auto merge = [&](std::vector<StrategySignal>& staged) {
+        for (auto& ss : staged) {
+            engine_->store_signal(ss);
+            signals.push_back(std::move(ss));
+        }
+        staged.clear();
+    };
+    for (auto& w : workers_) {
+        merge(w->staged);
+    }
+    merge(caller_staged_);
+    return signals;
+}
+
+void StrategyScheduler::enqueue(const Task& task) {
+    if (!running_.load(std::memory_order_acquire) || workers_.empty()) {
+        run_task(task, caller_staged_);
+        return;
+    }
+    // Round-robin placement; a full deque means the pool is saturated,
+    // so the submitter runs the task itself as backpressure.
+    for (size_t attempt = 0; attempt < workers_.size(); ++attempt) {
+        const size_t idx = next_worker_;
+        next_worker_ = (next_worker_ + 1) % workers_.size();
+        tasks_pending_.fetch_add(1, std::memory_order_release);
+        if (workers_[idx]->deque.push(task)) {
+            return;
+        }
+        tasks_pending_.fetch_sub(1, std::memory_order_release);
+    }
+    inline_runs_.fetch_add(1, std::memory_order_relaxed);
+    run_task(task, caller_staged_);
+}
+
+bool StrategyScheduler::try_steal(size_t self, Task& task) {
+    for (size_t i = 0; i < workers_.size(); ++i) {
+        const size_t victim = (self + 1 + i) % workers_.size();
+        if (workers_[victim]->deque.steal(task)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void StrategyScheduler::run_task(const Task& task,
+                                 std::vector<StrategySignal>& out) {
+    // Items run back to back on whichever thread claimed the task, so
+    // the strategy sees the same sequential call pattern as the plain
+    // StrategyEngine::evaluate loop.
+    for (size_t i = 0; i < task.count; ++i) {
+        const WorkItem& item = task.items[i];
+        Signal sig = task.strategy->evaluate(*item.snapshot, *item.trades);
+        StrategySignal ss;
+        ss.strategy_name = task.strategy->name();
+        ss.symbol = item.snapshot->symbol;
+        ss.signal = sig;
+        ss.confidence = std::clamp(
+            task.strategy->confidence(*item.snapshot, *item.trades, sig), 0.0,
+            1.0);
+        ss.timestamp_ns = tick_ns_;
+        out.push_back(std::move(ss));
+    }
+}
+
+void StrategyScheduler::worker_loop(size_t index) {
+    Worker& self = *workers_[index];
+    WaitStrategy wait;
+    Task task;
+    while (running_.load(std::memory_order_acquire)) {
+        if (self.deque.steal(task) || try_steal(index, task)) {
+            run_task(task, self.staged);
+            tasks_pending_.fetch_sub(1, std::memory_order_release);
+            wait.reset();
+        } else {
+            wait.idle();
+        }
+    }
+}
+
+} // namespace quantumflow
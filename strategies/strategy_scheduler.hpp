@@ -0,0 +1,129 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "common/wait_strategy.hpp"
+#include "strategies/strategy_base.hpp"
+#include "strategies/strategy_engine.hpp"
+
+namespace quantumflow {
+
+/// Work-stealing evaluation scheduler for StrategyEngine: per tick, one
+/// task per strategy fans out across a small worker pool so independent
+/// strategies evaluate concurrently instead of serially inside
+/// StrategyEngine::evaluate.
+///
+/// Tick protocol, driven from one thread (the consumer loop):
+///
+///   scheduler.begin_tick(engine, now_ns);
+///   scheduler.submit(snapshot, trades);   // once per evaluated symbol
+///   auto signals = scheduler.end_tick();  // blocks until all tasks ran
+///
+/// submit() only stages work: every snapshot submitted for a strategy is
+/// appended to that strategy's item list, and end_tick() enqueues at most
+/// ONE task per strategy carrying the whole list. Strategies are plain
+/// single-threaded objects (MomentumStrategy mutates a deque in
+/// evaluate), so the unit of parallelism is the strategy instance — a
+/// strategy never runs on two workers at once, only different strategies
+/// overlap. Multi-symbol strategies (non-empty Strategy::depends_on())
+/// additionally have each staged dependency snapshot delivered through
+/// observe() on the submitting thread, and are staged only once every
+/// declared symbol has been seen for the tick.
+///
+/// Results are gathered into per-worker staging vectors — no lock on the
+/// signal map — and merged into the engine's latest_signals_ store on
+/// the caller's thread inside end_tick. Snapshots and trade views passed
+/// to submit must stay valid until end_tick returns.
+class StrategyScheduler {
+public:
+    /// worker_count 0 sizes the pool to hardware_concurrency - 1
+    /// (leaving the submitting thread its core), minimum 1.
+    explicit StrategyScheduler(size_t worker_count = 0);
+    ~StrategyScheduler();
+
+    StrategyScheduler(const StrategyScheduler&) = delete;
+    StrategyScheduler& operator=(const StrategyScheduler&) = delete;
+
+    void start();
+    void stop();
+
+    void begin_tick(StrategyEngine& engine, uint64_t now_ns);
+    void submit(const BookSnapshot& snapshot, const TradeView& trades);
+    std::vector<StrategySignal> end_tick();
+
+    size_t worker_count() const { return workers_.size(); }
+
+    /// Tasks that could not be enqueued (all deques full) and ran inline
+    /// on the submitting thread instead; persistent overflow means the
+    /// deque capacity or worker count needs raising.
+    uint64_t inline_runs() const {
+        return inline_runs_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct WorkItem {
+        const BookSnapshot* snapshot;
+        const TradeView* trades;
+    };
+
+    /// One task covers every snapshot staged for one strategy this tick;
+    /// items points into pending_[i], which is stable once end_tick
+    /// starts enqueueing.
+    struct Task {
+        Strategy* strategy;
+        const WorkItem* items;
+        size_t count;
+    };
+
+    /// Bounded work-stealing deque. Tasks only ever originate on the tick
+    /// thread, so this is the single-producer corner of Chase-Lev: the
+    /// submitter pushes at the bottom, the owning worker takes from the
+    /// top and thieves steal from the same end when their own deque runs
+    /// dry (bottom never retreats, which is what makes the top CAS safe).
+    /// Capacity overflow is handled by the submitter running the task
+    /// inline, which doubles as backpressure.
+    class WorkDeque {
+    public:
+        bool push(const Task& task);   // tick thread only
+        bool steal(Task& task);        // any thread
+
+    private:
+        static constexpr size_t CAPACITY = 256; // power of two
+        alignas(64) std::atomic<int64_t> top_{0};
+        alignas(64) std::atomic<int64_t> bottom_{0};
+        std::array<Task, CAPACITY> buffer_;
+    };
+
+    struct Worker {
+        WorkDeque deque;
+        std::vector<StrategySignal> staged; // merged on the tick thread
+        std::thread thread;
+    };
+
+    void worker_loop(size_t index);
+    bool try_steal(size_t self, Task& task);
+    void run_task(const Task& task, std::vector<StrategySignal>& out);
+    void enqueue(const Task& task);
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<bool> running_{false};
+    std::atomic<size_t> tasks_pending_{0};
+    std::atomic<uint64_t> inline_runs_{0};
+
+    // Tick-scoped state, touched only by the submitting thread.
+    StrategyEngine* engine_ = nullptr;
+    uint64_t tick_ns_ = 0;
+    size_t next_worker_ = 0;
+    std::vector<StrategySignal> caller_staged_; // inline-run results
+    std::unordered_map<std::string, const BookSnapshot*> staged_snapshots_;
+    std::vector<std::vector<WorkItem>> pending_; // per strategy, this tick
+    std::vector<bool> dependent_staged_;         // per strategy, this tick
+};
+
+} // namespace quantumflow
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include "LOB/Book.h"
+#include "LOB/Checksum.h"
+
+namespace {
+
+void fill_book(Book& book) {
+    for (PRICE p = 100; p <= 140; ++p) {
+        book.set_level(BUY, p, static_cast<Volume>(p) * 3);
+    }
+    for (PRICE p = 150; p <= 190; ++p) {
+        book.set_level(SELL, p, static_cast<Volume>(p) * 2);
+    }
+}
+
+} // namespace
+
+TEST(BookChecksumTest, MatchesDirectComputation) {
+    Book book;
+    fill_book(book);
+
+    ChecksumLevel bids[BookChecksum::DEPTH];
+    ChecksumLevel asks[BookChecksum::DEPTH];
+    size_t n_bids = 0;
+    size_t n_asks = 0;
+    for (PRICE p = 140; p >= 116 && n_bids < BookChecksum::DEPTH; --p) {
+        bids[n_bids++] = {p, static_cast<Volume>(p) * 3};
+    }
+    for (PRICE p = 150; p <= 174 && n_asks < BookChecksum::DEPTH; ++p) {
+        asks[n_asks++] = {p, static_cast<Volume>(p) * 2};
+    }
+
+    EXPECT_EQ(book.top_checksum(),
+              BookChecksum::compute(bids, n_bids, asks, n_asks));
+    EXPECT_TRUE(book.verify(BookChecksum::compute(bids, n_bids, asks, n_asks)));
+}
+
+TEST(BookChecksumTest, InWindowMutationChangesChecksum) {
+    Book book;
+    fill_book(book);
+    const uint32_t before = book.top_checksum();
+
+    book.set_level(BUY, 140, 999); // best bid volume changes
+    EXPECT_NE(book.top_checksum(), before);
+    EXPECT_FALSE(book.verify(before));
+}
+
+TEST(BookChecksumTest, DeepMutationKeepsChecksum) {
+    Book book;
+    fill_book(book);
+    const uint32_t before = book.top_checksum();
+
+    // 41 bid levels, checksum covers 25: price 100 is rank 41, far below
+    // the window floor, so the cached value must survive unchanged.
+    book.set_level(BUY, 100, 77777);
+    EXPECT_EQ(book.top_checksum(), before);
+
+    // Removing the deep level must not disturb it either.
+    book.set_level(BUY, 100, 0);
+    EXPECT_EQ(book.top_checksum(), before);
+}
+
+TEST(BookChecksumTest, BoundaryRemovalPromotesNextLevel) {
+    Book book;
+    fill_book(book);
+    (void)book.top_checksum(); // establish the window boundary
+
+    // Rank 25 on the bid side is price 116; removing it slides 115 into
+    // the window, which must invalidate and change the checksum.
+    const uint32_t before = book.top_checksum();
+    book.set_level(BUY, 116, 0);
+    EXPECT_NE(book.top_checksum(), before);
+}
+
+TEST(BookChecksumTest, ShallowDepthAndEmptyBook) {
+    Book book;
+    const uint32_t empty = book.top_checksum();
+
+    book.set_level(BUY, 100, 10);
+    book.set_level(SELL, 101, 20);
+    EXPECT_NE(book.top_checksum(5), empty);
+
+    ChecksumLevel bid{100, 10};
+    ChecksumLevel ask{101, 20};
+    EXPECT_TRUE(book.verify(BookChecksum::compute(&bid, 1, &ask, 1), 5));
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "common/book_features.hpp"
+#include "strategies/strategy_base.hpp"
+
+using namespace quantumflow;
+
+TEST(BookFeatures, SumMatchesScalarReferenceAtOddSizes) {
+    // Sizes straddle the vector widths (4 for AVX2, 8 for AVX-512) so the
+    // remainder loop is exercised.
+    for (size_t n : {0u, 1u, 3u, 4u, 5u, 8u, 13u, 64u}) {
+        std::vector<double> values(n);
+        double expected = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            values[i] = static_cast<double>(i) * 1.5 + 0.25;
+            expected += values[i];
+        }
+        EXPECT_NEAR(features::sum(values.data(), n), expected, 1e-9) << n;
+    }
+}
+
+TEST(BookFeatures, DotMatchesScalarReference) {
+    std::vector<double> a, b;
+    double expected = 0.0;
+    for (size_t i = 0; i < 17; ++i) {
+        a.push_back(static_cast<double>(i) + 0.5);
+        b.push_back(2.0 * static_cast<double>(i) - 3.0);
+        expected += a.back() * b.back();
+    }
+    EXPECT_NEAR(features::dot(a.data(), b.data(), a.size()), expected, 1e-9);
+}
+
+TEST(BookFeatures, VwapWeightsByVolume) {
+    const double prices[] = {100.0, 101.0, 102.0};
+    const double volumes[] = {1.0, 0.0, 3.0};
+    // (100*1 + 102*3) / 4 = 101.5
+    EXPECT_NEAR(features::vwap(prices, volumes, 3), 101.5, 1e-9);
+    EXPECT_DOUBLE_EQ(features::vwap(prices, volumes, 0), 0.0);
+}
+
+TEST(BookFeatures, WeightedImbalanceBounds) {
+    const double bids[] = {300.0, 100.0};
+    const double asks[] = {100.0, 100.0};
+    // (400 - 200) / 600
+    EXPECT_NEAR(features::weighted_imbalance(bids, 2, asks, 2), 1.0 / 3.0, 1e-9);
+    EXPECT_DOUBLE_EQ(features::weighted_imbalance(bids, 0, asks, 0), 0.0);
+    EXPECT_NEAR(features::weighted_imbalance(bids, 2, asks, 0), 1.0, 1e-9);
+}
+
+TEST(BookFeatures, SnapshotSoAMirrorsLevels) {
+    BookSnapshot snap;
+    snap.bids = {{100.0, 500, 3}, {99.0, 250, 1}};
+    snap.asks = {{101.0, 750, 2}};
+
+    const BookSideSoA& bids = snap.bids_soa();
+    const BookSideSoA& asks = snap.asks_soa();
+    ASSERT_EQ(bids.size(), 2u);
+    ASSERT_EQ(asks.size(), 1u);
+    EXPECT_DOUBLE_EQ(bids.prices[0], 100.0);
+    EXPECT_DOUBLE_EQ(bids.volumes[1], 250.0);
+    EXPECT_DOUBLE_EQ(asks.volumes[0], 750.0);
+
+    // Mutation plus invalidate_soa() must rebuild the mirror.
+    snap.bids[0].quantity = 999;
+    snap.invalidate_soa();
+    EXPECT_DOUBLE_EQ(snap.bids_soa().volumes[0], 999.0);
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+
+#include "journal/book_image.hpp"
+
+using quantumflow::book_image_path;
+using quantumflow::restore_book_image;
+using quantumflow::write_book_image;
+
+namespace {
+
+std::string temp_path(const char* name) {
+    return std::string("/tmp/qf_book_image_test_") + name + "_" +
+           std::to_string(::getpid()) + ".book";
+}
+
+} // namespace
+
+TEST(BookImageTest, RoundTripRestoresEveryLevel) {
+    const std::string path = temp_path("roundtrip");
+
+    Book source;
+    for (PRICE p = 100; p <= 120; ++p) {
+        source.set_level(BUY, p, static_cast<Volume>(p) * 10);
+    }
+    for (PRICE p = 125; p <= 150; ++p) {
+        source.set_level(SELL, p, static_cast<Volume>(p) * 7);
+    }
+    ASSERT_TRUE(write_book_image(source, "TEST-SYM", path, 42));
+
+    Book restored;
+    uint64_t saved_ns = 0;
+    EXPECT_EQ(restore_book_image(restored, path, &saved_ns), 21u + 26u);
+    EXPECT_EQ(saved_ns, 42u);
+
+    EXPECT_EQ(restored.get_buy_prices(), source.get_buy_prices());
+    EXPECT_EQ(restored.get_sell_prices(), source.get_sell_prices());
+    for (PRICE p = 100; p <= 120; ++p) {
+        auto it = restored.get_buy_limits().find(p);
+        ASSERT_NE(it, restored.get_buy_limits().end());
+        EXPECT_EQ(it->second->get_total_volume(), static_cast<Volume>(p) * 10);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(BookImageTest, RewriteIsAtomicReplacement) {
+    const std::string path = temp_path("rewrite");
+
+    Book source;
+    source.set_level(BUY, 100, 500);
+    ASSERT_TRUE(write_book_image(source, "TEST-SYM", path, 1));
+
+    // Second image fully replaces the first: the dropped level must not
+    // reappear on restore.
+    source.set_level(BUY, 100, 0);
+    source.set_level(BUY, 101, 900);
+    ASSERT_TRUE(write_book_image(source, "TEST-SYM", path, 2));
+
+    Book restored;
+    EXPECT_EQ(restore_book_image(restored, path), 1u);
+    EXPECT_EQ(restored.get_buy_limits().find(100),
+              restored.get_buy_limits().end());
+    auto it = restored.get_buy_limits().find(101);
+    ASSERT_NE(it, restored.get_buy_limits().end());
+    EXPECT_EQ(it->second->get_total_volume(), 900u);
+    std::remove(path.c_str());
+}
+
+TEST(BookImageTest, MissingFileIsColdStart) {
+    Book book;
+    EXPECT_EQ(restore_book_image(book, temp_path("missing")), 0u);
+    EXPECT_TRUE(book.get_buy_prices().empty());
+}
+
+TEST(BookImageTest, RestoreRejectsGarbage) {
+    const std::string path = temp_path("garbage");
+    {
+        FILE* f = std::fopen(path.c_str(), "wb");
+        ASSERT_NE(f, nullptr);
+        const char junk[4096] = {};
+        std::fwrite(junk, 1, sizeof(junk), f);
+        std::fclose(f);
+    }
+    Book book;
+    EXPECT_EQ(restore_book_image(book, path), 0u);
+    std::remove(path.c_str());
+}
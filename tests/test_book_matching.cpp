@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include "LOB/Book.h"
+
+// Regression tests for mixed L2/L3 feeds: aggregate levels built via
+// set_level carry volume but no resting Order objects, and a crossing
+// place_order must consume that volume instead of spinning on a
+// non-empty headless level.
+
+TEST(BookMatchingTest, CrossingOrderConsumesAggregateLevel) {
+    Book book;
+    book.set_level(SELL, 100, 50);
+
+    const Trades& trades = book.place_order(1, 0, BUY, 100, 30);
+    ASSERT_EQ(trades.size(), 1u);
+    EXPECT_EQ(trades[0].get_trade_price(), 100u);
+    EXPECT_EQ(trades[0].get_trade_volume(), 30u);
+    EXPECT_EQ(trades[0].get_matched_order(), 0u); // synthetic counterparty
+
+    // 20 left on the aggregate ask.
+    EXPECT_EQ(book.get_sell_levels_count(), 1u);
+    EXPECT_EQ(book.get_best_sell(), 100u);
+    EXPECT_EQ(book.get_buy_levels_count(), 0u);
+}
+
+TEST(BookMatchingTest, ExhaustedAggregateLevelIsRemoved) {
+    Book book;
+    book.set_level(SELL, 100, 50);
+
+    const Trades& trades = book.place_order(2, 0, BUY, 100, 80);
+    ASSERT_EQ(trades.size(), 1u);
+    EXPECT_EQ(trades[0].get_trade_volume(), 50u);
+
+    // The emptied aggregate level is unlinked and the remainder rests.
+    EXPECT_EQ(book.get_sell_levels_count(), 0u);
+    EXPECT_EQ(book.get_buy_levels_count(), 1u);
+    EXPECT_EQ(book.get_best_buy(), 100u);
+    EXPECT_EQ(book.get_resting_orders_count(), 1u);
+}
+
+TEST(BookMatchingTest, SweepsAcrossAggregateLevels) {
+    Book book;
+    book.set_level(SELL, 100, 10);
+    book.set_level(SELL, 101, 10);
+
+    const Trades& trades = book.place_order(3, 0, BUY, 101, 25);
+    ASSERT_EQ(trades.size(), 2u);
+    EXPECT_EQ(trades[0].get_trade_price(), 100u);
+    EXPECT_EQ(trades[1].get_trade_price(), 101u);
+
+    EXPECT_EQ(book.get_sell_levels_count(), 0u);
+    EXPECT_EQ(book.get_best_buy(), 101u); // 5 rests at the top
+}
+
+TEST(BookMatchingTest, AggregateBehindRestingOrdersStillMatches) {
+    Book book;
+    // A real resting ask plus an aggregate ask behind it.
+    book.place_order(10, 0, SELL, 100, 10);
+    book.set_level(SELL, 101, 10);
+
+    const Trades& trades = book.place_order(11, 0, BUY, 101, 15);
+    ASSERT_EQ(trades.size(), 2u);
+    EXPECT_EQ(trades[0].get_matched_order(), 10u);
+    EXPECT_EQ(trades[0].get_trade_volume(), 10u);
+    EXPECT_EQ(trades[1].get_matched_order(), 0u);
+    EXPECT_EQ(trades[1].get_trade_volume(), 5u);
+
+    EXPECT_EQ(book.get_sell_levels_count(), 1u);
+    EXPECT_EQ(book.get_best_sell(), 101u);
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "common/latency_histogram.hpp"
+
+using namespace quantumflow;
+
+TEST(LatencyHistogram, EmptyStatsAreZero) {
+    LatencyHistogram hist;
+    auto stats = hist.stats();
+    EXPECT_EQ(stats.count, 0u);
+    EXPECT_DOUBLE_EQ(stats.p50_us, 0.0);
+    EXPECT_DOUBLE_EQ(stats.max_us, 0.0);
+}
+
+TEST(LatencyHistogram, PercentilesBracketRecordedValues) {
+    LatencyHistogram hist;
+    // 99 samples at ~10us, 1 sample at ~5ms.
+    for (int i = 0; i < 99; ++i) {
+        hist.record_ns(10'000);
+    }
+    hist.record_ns(5'000'000);
+
+    auto stats = hist.stats();
+    EXPECT_EQ(stats.count, 100u);
+
+    // Log2 buckets are conservative: estimates land within 2x of the value.
+    EXPECT_GE(stats.p50_us, 10.0);
+    EXPECT_LT(stats.p50_us, 20.0);
+    EXPECT_GE(stats.p99_us, 5'000.0);
+    EXPECT_DOUBLE_EQ(stats.max_us, 5'000.0);
+}
+
+TEST(LatencyHistogram, ResetStartsFreshWindow) {
+    LatencyHistogram hist;
+    hist.record_ns(1'000'000);
+    hist.reset();
+
+    auto stats = hist.stats();
+    EXPECT_EQ(stats.count, 0u);
+    EXPECT_DOUBLE_EQ(stats.max_us, 0.0);
+}
+
+TEST(LatencyHistogram, ConcurrentRecordersLoseNoSamples) {
+    LatencyHistogram hist;
+    constexpr int THREADS = 4;
+    constexpr int PER_THREAD = 10'000;
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < THREADS; ++t) {
+        workers.emplace_back([&hist] {
+            for (int i = 0; i < PER_THREAD; ++i) {
+                hist.record_ns(1'000 + static_cast<uint64_t>(i));
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    EXPECT_EQ(hist.stats().count,
+              static_cast<uint64_t>(THREADS) * PER_THREAD);
+}
+
+TEST(LatencyHistogramSet, StatsCoverAllStages) {
+    LatencyHistogramSet set;
+    set.python_to_cpp.record_us(12.0);
+    set.total.record_us(50.0);
+
+    auto stats = set.stats();
+    EXPECT_EQ(stats.python_to_cpp.count, 1u);
+    EXPECT_EQ(stats.total.count, 1u);
+    EXPECT_EQ(stats.order_match.count, 0u);
+
+    set.reset();
+    EXPECT_EQ(set.stats().python_to_cpp.count, 0u);
+}
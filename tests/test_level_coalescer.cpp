@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <tuple>
+#include <vector>
+
+#include "common/level_coalescer.hpp"
+
+using quantumflow::LevelCoalescer;
+using Applied = std::tuple<quantumflow::SymbolId, uint8_t, uint64_t, uint64_t>;
+
+namespace {
+
+std::vector<Applied> drain(LevelCoalescer& c) {
+    std::vector<Applied> out;
+    c.flush([&](quantumflow::SymbolId sym, uint8_t side, uint64_t price,
+                uint64_t qty) { out.emplace_back(sym, side, price, qty); });
+    return out;
+}
+
+} // namespace
+
+TEST(LevelCoalescerTest, DuplicateKeyKeepsLastValue) {
+    LevelCoalescer c;
+    EXPECT_TRUE(c.stage(1, 0, 50000, 10));
+    EXPECT_TRUE(c.stage(1, 0, 50000, 20));
+    EXPECT_TRUE(c.stage(1, 0, 50000, 30));
+
+    EXPECT_EQ(c.staged(), 1u);
+    EXPECT_EQ(c.coalesced_count(), 2u);
+
+    auto applied = drain(c);
+    ASSERT_EQ(applied.size(), 1u);
+    EXPECT_EQ(applied[0], Applied(1, 0, 50000, 30));
+    EXPECT_TRUE(c.empty());
+}
+
+TEST(LevelCoalescerTest, DistinctKeysDoNotCollide) {
+    LevelCoalescer c;
+    EXPECT_TRUE(c.stage(1, 0, 50000, 10)); // bid
+    EXPECT_TRUE(c.stage(1, 1, 50000, 11)); // ask, same price
+    EXPECT_TRUE(c.stage(2, 0, 50000, 12)); // other symbol
+    EXPECT_TRUE(c.stage(1, 0, 50001, 13)); // other price
+
+    EXPECT_EQ(c.staged(), 4u);
+    EXPECT_EQ(c.coalesced_count(), 0u);
+
+    auto applied = drain(c);
+    ASSERT_EQ(applied.size(), 4u);
+    // First-staged order is preserved across the flush walk.
+    EXPECT_EQ(applied[0], Applied(1, 0, 50000, 10));
+    EXPECT_EQ(applied[1], Applied(1, 1, 50000, 11));
+    EXPECT_EQ(applied[2], Applied(2, 0, 50000, 12));
+    EXPECT_EQ(applied[3], Applied(1, 0, 50001, 13));
+}
+
+TEST(LevelCoalescerTest, FullTableRejectsNewKeys) {
+    LevelCoalescer c;
+    for (uint64_t i = 0; i < LevelCoalescer::SLOT_COUNT; ++i) {
+        ASSERT_TRUE(c.stage(1, 0, 10000 + i, i));
+    }
+    // New key: rejected. Existing key: still folds in place.
+    EXPECT_FALSE(c.stage(1, 0, 999999, 1));
+    EXPECT_TRUE(c.stage(1, 0, 10000, 42));
+
+    auto applied = drain(c);
+    EXPECT_EQ(applied.size(), LevelCoalescer::SLOT_COUNT);
+    EXPECT_EQ(applied[0], Applied(1, 0, 10000, 42));
+
+    // Flush empties the table; staging works again.
+    EXPECT_TRUE(c.stage(1, 0, 999999, 1));
+}
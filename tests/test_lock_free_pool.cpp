@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "memory/allocator.h"
+
+using engine::memory::fast::LockFreePool;
+using engine::memory::fast::LockFreePoolStats;
+
+namespace {
+
+struct Block {
+    uint64_t payload[4];
+};
+
+} // namespace
+
+TEST(LockFreePoolTest, FixedCapacityWithoutCap) {
+    LockFreePool<Block> pool(8); // maxBlocks omitted: old fixed behaviour
+    std::vector<Block*> held;
+    for (int i = 0; i < 8; ++i) {
+        Block* b = pool.allocate();
+        ASSERT_NE(b, nullptr);
+        held.push_back(b);
+    }
+    EXPECT_EQ(pool.allocate(), nullptr);
+
+    LockFreePoolStats s = pool.stats();
+    EXPECT_EQ(s.capacity, 8u);
+    EXPECT_EQ(s.inUse, 8u);
+    EXPECT_EQ(s.highWater, 8u);
+    EXPECT_EQ(s.slabCount, 1u);
+    EXPECT_EQ(s.growEvents, 0u);
+    EXPECT_EQ(s.failedAllocations, 1u);
+
+    for (Block* b : held) pool.deallocate(b);
+    EXPECT_EQ(pool.size(), 0u);
+}
+
+TEST(LockFreePoolTest, GrowsInSlabsUpToHardCap) {
+    LockFreePool<Block> pool(4, 10); // slabs of 4, capped at 10
+    std::vector<Block*> held;
+    for (int i = 0; i < 10; ++i) {
+        Block* b = pool.allocate();
+        ASSERT_NE(b, nullptr) << "allocation " << i;
+        held.push_back(b);
+    }
+    EXPECT_EQ(pool.allocate(), nullptr); // cap reached
+
+    LockFreePoolStats s = pool.stats();
+    EXPECT_EQ(s.capacity, 10u); // 4 + 4 + 2 (last slab clipped to the cap)
+    EXPECT_EQ(s.slabCount, 3u);
+    EXPECT_EQ(s.growEvents, 2u);
+    EXPECT_EQ(s.highWater, 10u);
+    EXPECT_EQ(s.failedAllocations, 1u);
+
+    // Freed blocks are reusable without further growth.
+    pool.deallocate(held.back());
+    held.pop_back();
+    Block* again = pool.allocate();
+    ASSERT_NE(again, nullptr);
+    held.push_back(again);
+    EXPECT_EQ(pool.stats().growEvents, 2u);
+
+    for (Block* b : held) pool.deallocate(b);
+}
+
+TEST(LockFreePoolTest, ConcurrentChurnAcrossGrowth) {
+    constexpr int THREADS = 4;
+    constexpr int ITERS = 20000;
+    LockFreePool<Block> pool(64, 4096);
+    std::atomic<size_t> failures{0};
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < THREADS; ++t) {
+        workers.emplace_back([&] {
+            std::vector<Block*> mine;
+            mine.reserve(32);
+            for (int i = 0; i < ITERS; ++i) {
+                Block* b = pool.allocate();
+                if (!b) {
+                    failures.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                b->payload[0] = static_cast<uint64_t>(i);
+                mine.push_back(b);
+                if (mine.size() >= 32) {
+                    for (Block* p : mine) pool.deallocate(p);
+                    mine.clear();
+                }
+            }
+            for (Block* p : mine) pool.deallocate(p);
+        });
+    }
+    for (auto& w : workers) w.join();
+
+    EXPECT_EQ(failures.load(), 0u); // cap is far above THREADS * 32
+    LockFreePoolStats s = pool.stats();
+    EXPECT_EQ(s.inUse, 0u);
+    EXPECT_LE(s.highWater, static_cast<size_t>(THREADS) * 32);
+    EXPECT_LE(s.capacity, 4096u);
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "ingest/okx_json_parser.hpp"
+
+using quantumflow::MarketDataPacket;
+using quantumflow::OkxJsonParser;
+
+namespace {
+
+constexpr uint64_t PRICE_SCALE = 100;
+constexpr uint64_t QTY_SCALE = 100000000; // 1e8, matching the bridge sink
+
+std::vector<MarketDataPacket> parse_with(OkxJsonParser& parser,
+                                         const std::string& msg) {
+    std::vector<MarketDataPacket> out;
+    parser.parse(msg.data(), msg.size(), PRICE_SCALE, QTY_SCALE, 42,
+                 [&](const MarketDataPacket& p) { out.push_back(p); });
+    return out;
+}
+
+std::vector<MarketDataPacket> parse(const std::string& msg) {
+    OkxJsonParser parser;
+    return parse_with(parser, msg);
+}
+
+} // namespace
+
+TEST(OkxJsonParserTest, ParsesBooksMessage) {
+    const std::string msg =
+        R"({"arg":{"channel":"books5","instId":"BTC-USDT"},)"
+        R"("data":[{"asks":[["41006.8","0.60038921","0","1"]],)"
+        R"("bids":[["41006.3","0.30178218","0","2"],["41006.2","0","0","0"]],)"
+        R"("ts":"1629966436396","checksum":-1404728904}]})";
+
+    auto pkts = parse(msg);
+    ASSERT_EQ(pkts.size(), 4u); // 3 levels + trailing checksum
+
+    // Asks first, then bids, each in message order.
+    EXPECT_EQ(pkts[0].event_type, quantumflow::EVENT_BOOK_LEVEL);
+    EXPECT_EQ(pkts[0].side, 1);
+    EXPECT_EQ(pkts[0].price, 4100680u);
+    EXPECT_EQ(pkts[0].quantity, 60038921u);
+    EXPECT_STREQ(pkts[0].symbol, "BTC-USDT");
+    EXPECT_EQ(pkts[0].timestamp_ns, 42u);
+
+    EXPECT_EQ(pkts[1].side, 0);
+    EXPECT_EQ(pkts[1].price, 4100630u);
+    EXPECT_EQ(pkts[1].quantity, 30178218u);
+
+    // Zero size removes the level downstream; it must survive parsing.
+    EXPECT_EQ(pkts[2].price, 4100620u);
+    EXPECT_EQ(pkts[2].quantity, 0u);
+
+    // books5 snapshots close with the canonical checksum over the levels.
+    EXPECT_EQ(pkts.back().event_type, quantumflow::EVENT_BOOK_CHECKSUM);
+}
+
+TEST(OkxJsonParserTest, ParsesTradesMessage) {
+    const std::string msg =
+        R"({"arg":{"channel":"trades","instId":"ETH-USDT"},)"
+        R"("data":[{"instId":"ETH-USDT","tradeId":"130639474","px":"2219.95",)"
+        R"("sz":"0.1","side":"buy","ts":"1629386781174"},)"
+        R"({"px":"2219.9","sz":"2","side":"sell","ts":"1629386781175"}]})";
+
+    auto pkts = parse(msg);
+    ASSERT_EQ(pkts.size(), 2u);
+
+    EXPECT_EQ(pkts[0].event_type, quantumflow::EVENT_TRADE);
+    EXPECT_EQ(pkts[0].side, 0);
+    EXPECT_EQ(pkts[0].price, 221995u);
+    EXPECT_EQ(pkts[0].quantity, 10000000u);
+    EXPECT_STREQ(pkts[0].symbol, "ETH-USDT");
+
+    EXPECT_EQ(pkts[1].side, 1);
+    EXPECT_EQ(pkts[1].price, 221990u);
+    EXPECT_EQ(pkts[1].quantity, 200000000u);
+}
+
+TEST(OkxJsonParserTest, Books5DiffRetiresVanishedLevels) {
+    // Consecutive full snapshots: a bid that silently disappears must be
+    // retired with a qty-0 removal, placed before the checksum packet so
+    // the consumer's verify sees the corrected book.
+    OkxJsonParser parser;
+    const std::string first =
+        R"({"arg":{"channel":"books5","instId":"BTC-USDT"},)"
+        R"("data":[{"asks":[["41007.0","1","0","1"]],)"
+        R"("bids":[["41006.3","0.3","0","2"],["41006.2","0.5","0","1"]],)"
+        R"("ts":"1"}]})";
+    const std::string second =
+        R"({"arg":{"channel":"books5","instId":"BTC-USDT"},)"
+        R"("data":[{"asks":[["41007.0","1","0","1"]],)"
+        R"("bids":[["41006.3","0.4","0","2"]],)"
+        R"("ts":"2"}]})";
+
+    auto pkts = parse_with(parser, first);
+    ASSERT_EQ(pkts.size(), 4u); // 3 levels + checksum, nothing to retire
+    EXPECT_EQ(pkts.back().event_type, quantumflow::EVENT_BOOK_CHECKSUM);
+
+    pkts = parse_with(parser, second);
+    ASSERT_EQ(pkts.size(), 4u); // 2 levels + removal + checksum
+    EXPECT_EQ(pkts[2].event_type, quantumflow::EVENT_BOOK_LEVEL);
+    EXPECT_EQ(pkts[2].side, 0);
+    EXPECT_EQ(pkts[2].price, 4100620u); // the vanished bid
+    EXPECT_EQ(pkts[2].quantity, 0u);
+    EXPECT_EQ(pkts[3].event_type, quantumflow::EVENT_BOOK_CHECKSUM);
+
+    // Unchanged snapshot: no removals, book already agrees.
+    pkts = parse_with(parser, second);
+    ASSERT_EQ(pkts.size(), 3u);
+    EXPECT_EQ(pkts.back().event_type, quantumflow::EVENT_BOOK_CHECKSUM);
+}
+
+TEST(OkxJsonParserTest, IgnoresControlMessages) {
+    EXPECT_TRUE(parse(R"({"event":"subscribe","arg":{"channel":"books5","instId":"BTC-USDT"}})").empty());
+    EXPECT_TRUE(parse(R"({"event":"error","code":"60012","msg":"bad request"})").empty());
+    EXPECT_TRUE(parse("pong").empty());
+    EXPECT_TRUE(parse("").empty());
+}
+
+TEST(OkxJsonParserTest, ScaledDecimalConversion) {
+    uint64_t v = 0;
+    auto conv = [&](const char* s, uint64_t scale) {
+        const bool ok = OkxJsonParser::parse_scaled(s, s + std::strlen(s), scale, v);
+        return ok;
+    };
+
+    EXPECT_TRUE(conv("41006.8", 100));
+    EXPECT_EQ(v, 4100680u);
+    EXPECT_TRUE(conv("42", 100));
+    EXPECT_EQ(v, 4200u);
+    EXPECT_TRUE(conv("0.00000001", QTY_SCALE));
+    EXPECT_EQ(v, 1u);
+    // Excess fractional digits round half-up at the scale boundary.
+    EXPECT_TRUE(conv("1.005", 100));
+    EXPECT_EQ(v, 101u);
+    EXPECT_TRUE(conv("1.004", 100));
+    EXPECT_EQ(v, 100u);
+
+    EXPECT_FALSE(conv("1.2.3", 100));
+    EXPECT_FALSE(conv("12a", 100));
+    EXPECT_FALSE(conv("1", 3)); // non-power-of-ten scale
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include "bridge/packet_capture.hpp"
+
+using namespace quantumflow;
+
+static MarketDataPacket make_packet(const char* sym, uint64_t price_ticks,
+                                    uint64_t qty, uint64_t ts) {
+    MarketDataPacket p{};
+    std::strncpy(p.symbol, sym, sizeof(p.symbol) - 1);
+    p.side = 0;
+    p.event_type = 0;
+    p.price = price_ticks;
+    p.quantity = qty;
+    p.timestamp_ns = ts;
+    return p;
+}
+
+namespace {
+
+// Temp capture file removed on scope exit so test runs don't accumulate.
+struct TempCaptureFile {
+    std::string path;
+    explicit TempCaptureFile(const char* name)
+        : path(std::string("/tmp/") + name) {
+        std::remove(path.c_str());
+    }
+    ~TempCaptureFile() { std::remove(path.c_str()); }
+};
+
+} // namespace
+
+TEST(PacketCapture, RoundTripPreservesRecords) {
+    TempCaptureFile file("qf_test_capture_roundtrip.qfcap");
+
+    PacketCaptureWriter writer;
+    ASSERT_TRUE(writer.open(file.path));
+    for (uint64_t i = 0; i < 1000; ++i) {
+        writer.record(make_packet("BTC-USDT", 4300000 + i, i, 100 + i),
+                      1000 + i * 10);
+    }
+    EXPECT_EQ(writer.record_count(), 1000u);
+    writer.close();
+
+    PacketCaptureReader reader;
+    ASSERT_TRUE(reader.open(file.path));
+    ASSERT_EQ(reader.size(), 1000u);
+    for (uint64_t i = 0; i < 1000; ++i) {
+        const CaptureRecord& rec = reader.at(i);
+        EXPECT_STREQ(rec.packet.symbol, "BTC-USDT");
+        EXPECT_EQ(rec.packet.price, 4300000 + i);
+        EXPECT_EQ(rec.packet.quantity, i);
+        EXPECT_EQ(rec.ingest_ns, 1000 + i * 10);
+    }
+}
+
+TEST(PacketCapture, WriterCrossesChunkBoundary) {
+    TempCaptureFile file("qf_test_capture_chunks.qfcap");
+
+    const uint64_t n = PacketCaptureWriter::CHUNK_RECORDS + 100;
+    PacketCaptureWriter writer;
+    ASSERT_TRUE(writer.open(file.path));
+    for (uint64_t i = 0; i < n; ++i) {
+        writer.record(make_packet("X", i, 1, i), i);
+    }
+    EXPECT_EQ(writer.record_count(), n);
+    writer.close();
+
+    PacketCaptureReader reader;
+    ASSERT_TRUE(reader.open(file.path));
+    ASSERT_EQ(reader.size(), n);
+    // Spot-check records straddling the chunk boundary.
+    for (uint64_t i = PacketCaptureWriter::CHUNK_RECORDS - 2;
+         i < PacketCaptureWriter::CHUNK_RECORDS + 2; ++i) {
+        EXPECT_EQ(reader.at(i).packet.price, i);
+        EXPECT_EQ(reader.at(i).ingest_ns, i);
+    }
+}
+
+TEST(PacketCapture, CloseTrimsFileToExactSize) {
+    TempCaptureFile file("qf_test_capture_trim.qfcap");
+
+    PacketCaptureWriter writer;
+    ASSERT_TRUE(writer.open(file.path));
+    for (uint64_t i = 0; i < 10; ++i) {
+        writer.record(make_packet("X", i, 1, i), i);
+    }
+    writer.close();
+
+    struct stat st{};
+    ASSERT_EQ(::stat(file.path.c_str(), &st), 0);
+    EXPECT_EQ(static_cast<size_t>(st.st_size),
+              QF_CAPTURE_HEADER_SIZE + 10 * sizeof(CaptureRecord));
+}
+
+TEST(PacketCapture, ReaderRejectsBadMagic) {
+    TempCaptureFile file("qf_test_capture_badmagic.qfcap");
+
+    // A header-sized file full of zeros has no valid magic.
+    FILE* f = std::fopen(file.path.c_str(), "wb");
+    ASSERT_NE(f, nullptr);
+    char zeros[QF_CAPTURE_HEADER_SIZE] = {};
+    ASSERT_EQ(std::fwrite(zeros, 1, sizeof(zeros), f), sizeof(zeros));
+    std::fclose(f);
+
+    PacketCaptureReader reader;
+    EXPECT_FALSE(reader.open(file.path));
+    EXPECT_FALSE(reader.is_open());
+}
+
+TEST(PacketCapture, ReaderClampsCountToFileSize) {
+    TempCaptureFile file("qf_test_capture_clamp.qfcap");
+
+    PacketCaptureWriter writer;
+    ASSERT_TRUE(writer.open(file.path));
+    for (uint64_t i = 0; i < 20; ++i) {
+        writer.record(make_packet("X", i, 1, i), i);
+    }
+    writer.close();
+
+    // Simulate a crash that lost the tail of the data: chop off the last
+    // five records without touching the header's record_count.
+    ASSERT_EQ(::truncate(file.path.c_str(),
+                         static_cast<off_t>(QF_CAPTURE_HEADER_SIZE +
+                                            15 * sizeof(CaptureRecord))),
+              0);
+
+    PacketCaptureReader reader;
+    ASSERT_TRUE(reader.open(file.path));
+    EXPECT_EQ(reader.size(), 15u);
+}
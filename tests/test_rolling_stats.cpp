@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "common/rolling_stats.hpp"
+#include "strategies/strategy_engine.hpp"
+#include "strategies/microstructure/liquidity_detector.hpp"
+
+using namespace quantumflow;
+
+namespace {
+
+TradeInfo trade(double price, uint64_t quantity, uint64_t ts_ns) {
+    return TradeInfo{price, quantity, 0, ts_ns};
+}
+
+} // namespace
+
+TEST(RollingWindowStats, CountWindowEvictsOldest) {
+    RollingWindowStats win = RollingWindowStats::by_count(3);
+    win.add(trade(100.0, 10, 1));
+    win.add(trade(101.0, 20, 2));
+    win.add(trade(102.0, 30, 3));
+    EXPECT_EQ(win.count(), 3u);
+    EXPECT_EQ(win.volume(), 60u);
+    EXPECT_NEAR(win.vwap(), (100.0 * 10 + 101.0 * 20 + 102.0 * 30) / 60.0, 1e-9);
+
+    // Fourth trade evicts the first; aggregates follow.
+    win.add(trade(103.0, 40, 4));
+    EXPECT_EQ(win.count(), 3u);
+    EXPECT_EQ(win.volume(), 90u);
+    EXPECT_NEAR(win.mean_price(), (101.0 + 102.0 + 103.0) / 3.0, 1e-9);
+}
+
+TEST(RollingWindowStats, TimeWindowEvictsOnAdvance) {
+    RollingWindowStats win = RollingWindowStats::by_time(1000);
+    win.add(trade(100.0, 1, 0));
+    win.add(trade(110.0, 1, 500));
+    win.add(trade(120.0, 1, 999));
+    EXPECT_EQ(win.count(), 3u);
+
+    win.advance(1000);  // first trade ages out at exactly ts + window
+    EXPECT_EQ(win.count(), 2u);
+    EXPECT_DOUBLE_EQ(win.min_price(), 110.0);
+
+    win.advance(5000);
+    EXPECT_EQ(win.count(), 0u);
+    EXPECT_DOUBLE_EQ(win.vwap(), 0.0);
+    EXPECT_DOUBLE_EQ(win.variance(), 0.0);
+}
+
+TEST(RollingWindowStats, VarianceMatchesScalarReference) {
+    RollingWindowStats win = RollingWindowStats::by_count(4);
+    const double prices[] = {99.0, 101.0, 100.0, 104.0, 96.0};
+    for (size_t i = 0; i < 5; ++i) {
+        win.add(trade(prices[i], 1, i));
+    }
+    // Window now holds the last four prices.
+    double mean = 0.0;
+    for (size_t i = 1; i < 5; ++i) mean += prices[i];
+    mean /= 4.0;
+    double var = 0.0;
+    for (size_t i = 1; i < 5; ++i) var += (prices[i] - mean) * (prices[i] - mean);
+    var /= 4.0;
+    EXPECT_NEAR(win.mean_price(), mean, 1e-9);
+    EXPECT_NEAR(win.variance(), var, 1e-9);
+}
+
+TEST(RollingWindowStats, MaxMinTrackEvictions) {
+    RollingWindowStats win = RollingWindowStats::by_count(3);
+    win.add(trade(105.0, 1, 1));
+    win.add(trade(95.0, 1, 2));
+    win.add(trade(100.0, 1, 3));
+    EXPECT_DOUBLE_EQ(win.max_price(), 105.0);
+    EXPECT_DOUBLE_EQ(win.min_price(), 95.0);
+
+    win.add(trade(100.0, 1, 4));  // evicts the 105 maximum
+    EXPECT_DOUBLE_EQ(win.max_price(), 100.0);
+    win.add(trade(100.0, 1, 5));  // evicts the 95 minimum
+    EXPECT_DOUBLE_EQ(win.min_price(), 100.0);
+
+    // Duplicate prices must survive eviction of one copy.
+    win.add(trade(100.0, 1, 6));
+    win.add(trade(100.0, 1, 7));
+    EXPECT_DOUBLE_EQ(win.max_price(), 100.0);
+    EXPECT_DOUBLE_EQ(win.min_price(), 100.0);
+}
+
+TEST(RollingTradeStats, DedupesIdenticalDeclarations) {
+    RollingTradeStats stats;
+    const auto a = stats.count_window(64);
+    const auto b = stats.count_window(64);
+    const auto c = stats.time_window(1'000'000);
+    const auto d = stats.time_window(1'000'000);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(c, d);
+    EXPECT_NE(a, c);
+    EXPECT_EQ(stats.window_count(), 2u);
+
+    stats.on_trade(trade(100.0, 5, 10));
+    EXPECT_EQ(stats.window(a).volume(), 5u);
+    EXPECT_EQ(stats.window(c).volume(), 5u);
+}
+
+TEST(RollingTradeStats, EngineFedDetectorMatchesDirectScan) {
+    // Same trades through an engine (window pre-filter active) and through a
+    // bare detector (pure scan) must produce identical signals.
+    StrategyEngine engine;
+    engine.add_strategy(std::make_unique<LiquidityDetector>(3, 50, 0.1));
+    LiquidityDetector bare(3, 50, 0.1);
+
+    std::vector<TradeInfo> trades;
+    for (int i = 0; i < 5; ++i) {
+        trades.push_back(trade(100.0, 30, static_cast<uint64_t>(i)));
+        engine.on_trade(trades.back());
+    }
+
+    BookSnapshot snap;
+    snap.symbol = "TEST";
+    snap.bids = {{100.0, 500, 3}};
+    snap.asks = {{100.5, 500, 3}};
+    snap.best_bid = 100.0;
+    snap.best_ask = 100.5;
+    snap.mid_price = 100.25;
+
+    const auto signals = engine.evaluate(snap, trades);
+    ASSERT_EQ(signals.size(), 1u);
+    EXPECT_EQ(signals[0].signal, bare.evaluate(snap, trades));
+    EXPECT_EQ(signals[0].signal, Signal::BUY);
+}
+
+TEST(RollingTradeStats, DetectorSkipsGateAcrossSymbols) {
+    // The engine-wide window mixes every symbol's trades while the view is
+    // per symbol, so with a small window another symbol's flow can evict
+    // this one's and the O(1) gate would veto an iceberg the exact scan
+    // finds. Once the detector has seen a second symbol it must fall back
+    // to the scan and agree with a bare detector.
+    StrategyEngine engine;
+    engine.add_strategy(
+        std::make_unique<LiquidityDetector>(3, 50, 0.1, /*stats_window=*/4));
+    LiquidityDetector bare(3, 50, 0.1);
+
+    std::vector<TradeInfo> trades_a;
+    for (int i = 0; i < 5; ++i) {
+        trades_a.push_back(trade(100.0, 30, static_cast<uint64_t>(i)));
+        engine.on_trade(trades_a.back());
+    }
+    // Symbol B's flow pushes every A trade out of the 4-deep window.
+    std::vector<TradeInfo> trades_b;
+    for (int i = 0; i < 10; ++i) {
+        trades_b.push_back(trade(200.0, 10, static_cast<uint64_t>(5 + i)));
+        engine.on_trade(trades_b.back());
+    }
+
+    BookSnapshot snap_b;
+    snap_b.symbol = "BBB";
+    snap_b.bids = {{200.0, 500, 3}};
+    snap_b.asks = {{200.5, 500, 3}};
+    snap_b.best_bid = 200.0;
+    snap_b.best_ask = 200.5;
+    snap_b.mid_price = 200.25;
+
+    BookSnapshot snap_a;
+    snap_a.symbol = "AAA";
+    snap_a.bids = {{100.0, 500, 3}};
+    snap_a.asks = {{100.5, 500, 3}};
+    snap_a.best_bid = 100.0;
+    snap_a.best_ask = 100.5;
+    snap_a.mid_price = 100.25;
+
+    (void)engine.evaluate(snap_b, trades_b); // second symbol disables the gate
+    const auto signals = engine.evaluate(snap_a, trades_a);
+    ASSERT_EQ(signals.size(), 1u);
+    EXPECT_EQ(signals[0].signal, bare.evaluate(snap_a, trades_a));
+    EXPECT_EQ(signals[0].signal, Signal::BUY);
+}
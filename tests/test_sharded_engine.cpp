@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include "engine/sharded_engine.hpp"
+
+using namespace quantumflow;
+
+static MarketDataPacket book_packet(const char* sym, uint8_t side,
+                                    uint64_t price_ticks, uint64_t qty) {
+    MarketDataPacket p{};
+    std::strncpy(p.symbol, sym, sizeof(p.symbol) - 1);
+    p.side = side;
+    p.event_type = 0;
+    p.price = price_ticks;
+    p.quantity = qty;
+    p.timestamp_ns = 1;
+    return p;
+}
+
+static bool wait_for_processed(const ShardedEngine& engine, uint64_t expected) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (engine.processed_count() >= expected) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+TEST(ShardedEngine, RoutingIsDeterministic) {
+    char raw[SYMBOL_RAW_LEN]{};
+    std::strncpy(raw, "BTC-USDT-SWAP", sizeof(raw) - 1);
+    uint64_t h1 = SymbolTable::hash_raw(raw);
+    uint64_t h2 = SymbolTable::hash_raw(raw);
+    EXPECT_EQ(h1, h2);
+}
+
+TEST(ShardedEngine, ProcessesPacketsAcrossShards) {
+    ShardedEngine engine(2, [] { return std::make_unique<StrategyEngine>(); });
+    engine.start();
+
+    constexpr int N = 100;
+    for (int i = 0; i < N; ++i) {
+        ASSERT_TRUE(engine.submit(
+            book_packet("BTC-USDT", 0, 10000 + static_cast<uint64_t>(i), 10)));
+        ASSERT_TRUE(engine.submit(
+            book_packet("ETH-USDT", 1, 200000 + static_cast<uint64_t>(i), 5)));
+    }
+
+    ASSERT_TRUE(wait_for_processed(engine, 2 * N));
+    EXPECT_EQ(engine.dropped_count(), 0u);
+
+    // Wait for a publish cycle to surface snapshots for both symbols.
+    bool saw_btc = false;
+    bool saw_eth = false;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (std::chrono::steady_clock::now() < deadline && !(saw_btc && saw_eth)) {
+        std::vector<BookSnapshot> snapshots;
+        std::vector<std::pair<std::string, std::vector<TradeInfo>>> trades;
+        std::unordered_map<std::string, StrategySignal> signals;
+        engine.collect(snapshots, trades, signals);
+        for (const auto& snap : snapshots) {
+            if (snap.symbol == "BTC-USDT" && !snap.bids.empty()) saw_btc = true;
+            if (snap.symbol == "ETH-USDT" && !snap.asks.empty()) saw_eth = true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_TRUE(saw_btc);
+    EXPECT_TRUE(saw_eth);
+
+    engine.stop();
+}
+
+TEST(ShardedEngine, StopIsIdempotent) {
+    ShardedEngine engine(1, [] { return std::make_unique<StrategyEngine>(); });
+    engine.start();
+    engine.stop();
+    engine.stop();
+    SUCCEED();
+}
+
+TEST(ShardedEngine, PerSymbolScalesFollowSymbolConfig) {
+    // Two symbols with different price scales on one shard: each trade
+    // must be converted with its own symbol's scale, independent of the
+    // order ids happen to be assigned in.
+    ShardedEngine engine(1, [] { return std::make_unique<StrategyEngine>(); });
+    engine.start();
+
+    MarketDataPacket cfg_a{};
+    std::strncpy(cfg_a.symbol, "AAA-USDT", sizeof(cfg_a.symbol) - 1);
+    cfg_a.event_type = EVENT_SYMBOL_CONFIG;
+    cfg_a.price = 100; // 2 decimal places
+    MarketDataPacket cfg_b = cfg_a;
+    std::strncpy(cfg_b.symbol, "BBB-USDT", sizeof(cfg_b.symbol) - 1);
+    cfg_b.price = 1000; // 3 decimal places
+    ASSERT_TRUE(engine.submit(cfg_a));
+    ASSERT_TRUE(engine.submit(cfg_b));
+
+    MarketDataPacket trade_a = book_packet("AAA-USDT", 0, 12345, 1);
+    trade_a.event_type = EVENT_TRADE;
+    MarketDataPacket trade_b = book_packet("BBB-USDT", 0, 12345, 1);
+    trade_b.event_type = EVENT_TRADE;
+    ASSERT_TRUE(engine.submit(trade_a));
+    ASSERT_TRUE(engine.submit(trade_b));
+
+    ASSERT_TRUE(wait_for_processed(engine, 4));
+
+    double price_a = 0.0;
+    double price_b = 0.0;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (std::chrono::steady_clock::now() < deadline &&
+           (price_a == 0.0 || price_b == 0.0)) {
+        std::vector<BookSnapshot> snapshots;
+        std::vector<std::pair<std::string, std::vector<TradeInfo>>> trades;
+        std::unordered_map<std::string, StrategySignal> signals;
+        engine.collect(snapshots, trades, signals);
+        for (const auto& [sym, buf] : trades) {
+            if (buf.empty()) continue;
+            if (sym == "AAA-USDT") price_a = buf.back().price;
+            if (sym == "BBB-USDT") price_b = buf.back().price;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    EXPECT_DOUBLE_EQ(price_a, 123.45);
+    EXPECT_DOUBLE_EQ(price_b, 12.345);
+
+    engine.stop();
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "common/signal_history.hpp"
+#include "strategies/strategy_engine.hpp"
+
+using namespace quantumflow;
+
+namespace {
+
+/// Emits whatever signal/confidence the test sets next.
+class ScriptedStrategy : public Strategy {
+public:
+    const std::string& name() const override {
+        static const std::string n = "Scripted";
+        return n;
+    }
+
+    Signal evaluate(const BookSnapshot&, const TradeView&) override {
+        return next_signal;
+    }
+
+    double confidence(const BookSnapshot&, const TradeView&,
+                      Signal) const override {
+        return next_confidence;
+    }
+
+    Signal next_signal = Signal::NEUTRAL;
+    double next_confidence = 0.0;
+};
+
+} // namespace
+
+TEST(SignalHistoryTest, RecordsOnlyTransitions) {
+    SignalHistoryRing ring;
+
+    EXPECT_TRUE(ring.record(Signal::NEUTRAL, 0.0, 1));
+    // Same signal, same confidence bucket: no new entry.
+    EXPECT_FALSE(ring.record(Signal::NEUTRAL, 0.05, 2));
+    EXPECT_FALSE(ring.record(Signal::NEUTRAL, 0.09, 3));
+    // Bucket moved (0.0x -> 0.3x) with the signal unchanged: recorded.
+    EXPECT_TRUE(ring.record(Signal::NEUTRAL, 0.35, 4));
+    // Signal moved with the bucket unchanged: recorded.
+    EXPECT_TRUE(ring.record(Signal::BUY, 0.36, 5));
+
+    ASSERT_EQ(ring.size(), 3u);
+    EXPECT_EQ(ring[0].timestamp_ns, 1u);
+    EXPECT_EQ(ring[1].timestamp_ns, 4u);
+    EXPECT_EQ(ring[1].confidence_bucket, 3);
+    EXPECT_EQ(ring[2].signal, Signal::BUY);
+    EXPECT_EQ(ring.transitions(), 3u);
+}
+
+TEST(SignalHistoryTest, OverwritesOldestAtCapacity) {
+    SignalHistoryRing ring;
+    const size_t total = SignalHistoryRing::CAPACITY + 10;
+    for (size_t i = 0; i < total; ++i) {
+        // Alternate signals so every record() appends.
+        ASSERT_TRUE(ring.record(i % 2 == 0 ? Signal::BUY : Signal::SELL,
+                                0.5, i));
+    }
+
+    EXPECT_EQ(ring.size(), SignalHistoryRing::CAPACITY);
+    EXPECT_EQ(ring.transitions(), total);
+    // Oldest retained entry is the first one not yet overwritten.
+    EXPECT_EQ(ring[0].timestamp_ns, 10u);
+    EXPECT_EQ(ring[ring.size() - 1].timestamp_ns, total - 1);
+}
+
+TEST(SignalHistoryTest, BinaryExportRoundTrip) {
+    SignalHistoryRing ring;
+    ring.record(Signal::BUY, 0.72, 100);
+    ring.record(Signal::SELL, 0.31, 200);
+
+    std::string out;
+    EXPECT_EQ(ring.export_binary(out), 2u);
+
+    // Header: "QFSH", uint16 version, uint16 count.
+    ASSERT_GE(out.size(), 8u);
+    EXPECT_EQ(out.compare(0, 4, "QFSH"), 0);
+    uint16_t version = 0, count = 0;
+    std::memcpy(&version, out.data() + 4, sizeof(version));
+    std::memcpy(&count, out.data() + 6, sizeof(count));
+    EXPECT_EQ(version, 1);
+    ASSERT_EQ(count, 2);
+
+    // Second record: uint64 ts, double confidence, uint8 signal, uint8 bucket.
+    const size_t record_size = 8 + 8 + 1 + 1;
+    ASSERT_EQ(out.size(), 8 + 2 * record_size);
+    const char* rec = out.data() + 8 + record_size;
+    uint64_t ts = 0;
+    double confidence = 0.0;
+    std::memcpy(&ts, rec, sizeof(ts));
+    std::memcpy(&confidence, rec + 8, sizeof(confidence));
+    EXPECT_EQ(ts, 200u);
+    EXPECT_DOUBLE_EQ(confidence, 0.31);
+    EXPECT_EQ(static_cast<Signal>(rec[16]), Signal::SELL);
+    EXPECT_EQ(rec[17], 3);
+}
+
+TEST(SignalHistoryTest, EngineRecordsTransitions) {
+    StrategyEngine engine;
+    auto strat = std::make_unique<ScriptedStrategy>();
+    ScriptedStrategy* scripted = strat.get();
+    engine.add_strategy(std::move(strat));
+
+    BookSnapshot snap;
+    snap.symbol = "BTC-USDT-SWAP";
+    TradeView trades;
+
+    EXPECT_EQ(engine.history("Scripted"), nullptr);
+
+    // Three identical evaluations collapse to one transition.
+    for (int i = 0; i < 3; ++i) {
+        engine.evaluate(snap, trades);
+    }
+    const SignalHistoryRing* hist = engine.history("Scripted");
+    ASSERT_NE(hist, nullptr);
+    EXPECT_EQ(hist->size(), 1u);
+
+    scripted->next_signal = Signal::BUY;
+    scripted->next_confidence = 0.8;
+    engine.evaluate(snap, trades);
+    EXPECT_EQ(hist->size(), 2u);
+    EXPECT_EQ((*hist)[1].signal, Signal::BUY);
+    EXPECT_EQ((*hist)[1].confidence_bucket, 8);
+}
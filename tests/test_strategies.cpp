@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include "strategies/strategy_base.hpp"
 #include "strategies/strategy_engine.hpp"
+#include "strategies/static_strategy_engine.hpp"
 #include "strategies/microstructure/order_book_imbalance.hpp"
 #include "strategies/microstructure/market_maker.hpp"
 #include "strategies/microstructure/vwap_executor.hpp"
@@ -264,3 +265,130 @@ TEST(StrategyEngine, ConfidenceReflectsSignalStrength) {
     EXPECT_EQ(signals[0].signal, Signal::BUY);
     EXPECT_GT(signals[0].confidence, 0.0);
 }
+
+TEST(StaticStrategyEngine, MatchesDynamicEngineSignals) {
+    StaticStrategyEngine<OrderBookImbalance, MomentumStrategy> static_engine;
+    StrategyEngine dynamic_engine;
+    dynamic_engine.add_strategy(std::make_unique<OrderBookImbalance>());
+    dynamic_engine.add_strategy(std::make_unique<MomentumStrategy>());
+
+    auto snap = make_snapshot(
+        {{100.0, 2000, 3}, {99.0, 1800, 3}},
+        {{101.0, 100, 3}, {102.0, 90, 3}}
+    );
+
+    const auto& static_signals = static_engine.evaluate(snap, {});
+    auto dynamic_signals = dynamic_engine.evaluate(snap, {});
+
+    ASSERT_EQ(static_signals.size(), dynamic_signals.size());
+    for (size_t i = 0; i < static_signals.size(); ++i) {
+        EXPECT_EQ(static_signals[i].strategy_name,
+                  dynamic_signals[i].strategy_name);
+        EXPECT_EQ(static_signals[i].signal, dynamic_signals[i].signal);
+        EXPECT_DOUBLE_EQ(static_signals[i].confidence,
+                         dynamic_signals[i].confidence);
+    }
+}
+
+TEST(StaticStrategyEngine, LatestSignalLookupByName) {
+    StaticStrategyEngine<OrderBookImbalance, MomentumStrategy> engine;
+    EXPECT_EQ(engine.strategy_count(), 2u);
+
+    auto snap = make_snapshot({{100.0, 500, 3}}, {{101.0, 500, 3}});
+    engine.evaluate(snap, {});
+
+    const StrategySignal* sig = engine.latest_signal("Momentum");
+    ASSERT_NE(sig, nullptr);
+    EXPECT_EQ(sig->strategy_name, "Momentum");
+    EXPECT_EQ(engine.latest_signal("NoSuchStrategy"), nullptr);
+}
+
+// --- Incremental snapshots (dirty-level tracking) ---
+
+static void expect_snapshots_equal(const BookSnapshot& a, const BookSnapshot& b) {
+    ASSERT_EQ(a.bids.size(), b.bids.size());
+    ASSERT_EQ(a.asks.size(), b.asks.size());
+    for (size_t i = 0; i < a.bids.size(); ++i) {
+        EXPECT_DOUBLE_EQ(a.bids[i].price, b.bids[i].price);
+        EXPECT_EQ(a.bids[i].quantity, b.bids[i].quantity);
+        EXPECT_EQ(a.bids[i].order_count, b.bids[i].order_count);
+    }
+    for (size_t i = 0; i < a.asks.size(); ++i) {
+        EXPECT_DOUBLE_EQ(a.asks[i].price, b.asks[i].price);
+        EXPECT_EQ(a.asks[i].quantity, b.asks[i].quantity);
+        EXPECT_EQ(a.asks[i].order_count, b.asks[i].order_count);
+    }
+    EXPECT_DOUBLE_EQ(a.best_bid, b.best_bid);
+    EXPECT_DOUBLE_EQ(a.best_ask, b.best_ask);
+    EXPECT_DOUBLE_EQ(a.mid_price, b.mid_price);
+}
+
+TEST(IncrementalSnapshot, UpdateMatchesFullRebuildAfterInserts) {
+    Book book;
+    PriceConverter conv;
+    book.place_order(1, 0, BUY, 10000, 100);
+    book.place_order(2, 0, SELL, 10100, 50);
+
+    auto snap = BookSnapshot::from_book(book, "TEST", conv);
+    EXPECT_FALSE(book.has_dirty_levels());
+
+    book.place_order(3, 0, BUY, 9900, 200);
+    book.place_order(4, 0, SELL, 10200, 75);
+    EXPECT_TRUE(book.has_dirty_levels());
+
+    snap.update_from_book(book, conv);
+    EXPECT_FALSE(book.has_dirty_levels());
+    expect_snapshots_equal(snap, BookSnapshot::from_book(book, "TEST", conv));
+}
+
+TEST(IncrementalSnapshot, UpdateRemovesEmptiedLevels) {
+    Book book;
+    PriceConverter conv;
+    book.place_order(1, 0, BUY, 10000, 100);
+    book.place_order(2, 0, BUY, 9900, 100);
+    book.place_order(3, 0, SELL, 10100, 100);
+
+    auto snap = BookSnapshot::from_book(book, "TEST", conv);
+    ASSERT_EQ(snap.bids.size(), 2u);
+
+    // Cancel one bid entirely and sweep the ask.
+    book.delete_order(2);
+    book.place_order(4, 0, BUY, 10100, 100);
+
+    snap.update_from_book(book, conv);
+    EXPECT_EQ(snap.bids.size(), 1u);
+    EXPECT_TRUE(snap.asks.empty());
+    expect_snapshots_equal(snap, BookSnapshot::from_book(book, "TEST", conv));
+}
+
+TEST(IncrementalSnapshot, UpdatePatchesModifiedVolume) {
+    Book book;
+    PriceConverter conv;
+    book.place_order(1, 0, BUY, 10000, 100);
+    book.place_order(2, 0, SELL, 10100, 100);
+
+    auto snap = BookSnapshot::from_book(book, "TEST", conv);
+
+    // Partial fill against the resting ask leaves it at reduced volume.
+    book.place_order(3, 0, BUY, 10100, 40);
+
+    snap.update_from_book(book, conv);
+    ASSERT_EQ(snap.asks.size(), 1u);
+    EXPECT_EQ(snap.asks[0].quantity, 60u);
+    expect_snapshots_equal(snap, BookSnapshot::from_book(book, "TEST", conv));
+}
+
+TEST(IncrementalSnapshot, NoDirtyLevelsIsANoOpOnDepth) {
+    Book book;
+    PriceConverter conv;
+    book.place_order(1, 0, BUY, 10000, 100);
+    book.place_order(2, 0, SELL, 10100, 100);
+
+    auto snap = BookSnapshot::from_book(book, "TEST", conv);
+    auto before_bids = snap.bids;
+    auto before_asks = snap.asks;
+
+    snap.update_from_book(book, conv);
+    EXPECT_EQ(snap.bids.size(), before_bids.size());
+    EXPECT_EQ(snap.asks.size(), before_asks.size());
+}
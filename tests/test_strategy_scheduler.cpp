@@ -0,0 +1,227 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "strategies/strategy_scheduler.hpp"
+#include "strategies/equities/pairs_trading.hpp"
+
+using namespace quantumflow;
+
+namespace {
+
+BookSnapshot make_snapshot(const std::string& symbol, double mid) {
+    BookSnapshot snap;
+    snap.symbol = symbol;
+    snap.best_bid = mid - 0.5;
+    snap.best_ask = mid + 0.5;
+    snap.mid_price = mid;
+    snap.timestamp_ns = 1;
+    return snap;
+}
+
+/// Counts evaluations and records which threads ran them.
+class CountingStrategy : public Strategy {
+public:
+    explicit CountingStrategy(std::string name) : name_(std::move(name)) {}
+
+    const std::string& name() const override { return name_; }
+
+    Signal evaluate(const BookSnapshot&, const TradeView&) override {
+        evaluations.fetch_add(1, std::memory_order_relaxed);
+        // Burn a little CPU so tasks outlast the helping tick thread and
+        // the workers get a window to steal, even on small machines.
+        volatile unsigned sink = 0;
+        for (unsigned k = 0; k < 20000; ++k) sink = sink + k;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            threads.insert(std::this_thread::get_id());
+        }
+        return Signal::BUY;
+    }
+
+    std::atomic<int> evaluations{0};
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+
+private:
+    std::string name_;
+};
+
+/// Deliberately NOT thread-safe, like the real strategies (Momentum
+/// mutates a deque in evaluate): a plain counter plus an overlap
+/// detector. The scheduler's contract is that one instance never
+/// evaluates on two threads at once, so overlaps must stay zero and the
+/// unsynchronized counter must come out exact.
+class RacyStrategy : public Strategy {
+public:
+    explicit RacyStrategy(std::string name) : name_(std::move(name)) {}
+
+    const std::string& name() const override { return name_; }
+
+    Signal evaluate(const BookSnapshot&, const TradeView&) override {
+        if (busy.exchange(true, std::memory_order_acquire)) {
+            overlaps.fetch_add(1, std::memory_order_relaxed);
+        }
+        ++calls; // unsynchronized on purpose
+        volatile unsigned sink = 0;
+        for (unsigned k = 0; k < 20000; ++k) sink = sink + k;
+        busy.store(false, std::memory_order_release);
+        return Signal::NEUTRAL;
+    }
+
+    int calls = 0;
+    std::atomic<bool> busy{false};
+    std::atomic<int> overlaps{0};
+
+private:
+    std::string name_;
+};
+
+} // namespace
+
+TEST(StrategySchedulerTest, EvaluatesEveryStrategyPerSnapshot) {
+    StrategyEngine engine;
+    std::vector<CountingStrategy*> raw;
+    for (int i = 0; i < 8; ++i) {
+        auto s = std::make_unique<CountingStrategy>("count" + std::to_string(i));
+        raw.push_back(s.get());
+        engine.add_strategy(std::move(s));
+    }
+
+    StrategyScheduler scheduler(2);
+    scheduler.start();
+
+    TradeRing<64> trades;
+    BookSnapshot snap_a = make_snapshot("AAA", 100.0);
+    BookSnapshot snap_b = make_snapshot("BBB", 200.0);
+    TradeView view = trades.view();
+
+    for (int tick = 0; tick < 50; ++tick) {
+        scheduler.begin_tick(engine, 1000 + tick);
+        scheduler.submit(snap_a, view);
+        scheduler.submit(snap_b, view);
+        auto signals = scheduler.end_tick();
+        ASSERT_EQ(signals.size(), 16u); // 8 strategies x 2 snapshots
+    }
+    scheduler.stop();
+
+    for (auto* s : raw) {
+        EXPECT_EQ(s->evaluations.load(), 100); // 2 snapshots x 50 ticks
+    }
+    // The merged store holds the latest signal for every strategy.
+    EXPECT_EQ(engine.all_signals().size(), 8u);
+    EXPECT_NE(engine.latest_signal("count0"), nullptr);
+}
+
+TEST(StrategySchedulerTest, DependentStrategyWaitsForAllLegs) {
+    StrategyEngine engine;
+    auto pairs = std::make_unique<PairsTrading>(1.0, 4, 2.0);
+    pairs->set_pair("AAA", "BBB");
+    PairsTrading* pairs_raw = pairs.get();
+    engine.add_strategy(std::move(pairs));
+
+    StrategyScheduler scheduler(2);
+    scheduler.start();
+
+    TradeRing<64> trades;
+    TradeView view = trades.view();
+    BookSnapshot snap_a = make_snapshot("AAA", 100.0);
+    BookSnapshot snap_b = make_snapshot("BBB", 50.0);
+
+    // Only one leg staged: the pair must not run this tick.
+    scheduler.begin_tick(engine, 1);
+    scheduler.submit(snap_a, view);
+    EXPECT_TRUE(scheduler.end_tick().empty());
+
+    // Both legs staged: exactly one evaluation, fed from both mids.
+    for (int tick = 0; tick < 6; ++tick) {
+        scheduler.begin_tick(engine, 2 + tick);
+        scheduler.submit(snap_a, view);
+        scheduler.submit(snap_b, view);
+        auto signals = scheduler.end_tick();
+        ASSERT_EQ(signals.size(), 1u);
+        EXPECT_EQ(signals[0].strategy_name, "PairsTrading");
+        EXPECT_EQ(signals[0].symbol, "AAA"); // evaluated against leg 1
+    }
+    scheduler.stop();
+
+    // Six complete pair observations with a window of 4: the z-score is
+    // computable, so evaluate() no longer bails to NEUTRAL-for-lack-of-data.
+    EXPECT_EQ(pairs_raw->depends_on().size(), 2u);
+}
+
+TEST(StrategySchedulerTest, WorkersShareTheLoad) {
+    StrategyEngine engine;
+    std::vector<CountingStrategy*> raw;
+    for (int i = 0; i < 8; ++i) {
+        auto s = std::make_unique<CountingStrategy>("spread" + std::to_string(i));
+        raw.push_back(s.get());
+        engine.add_strategy(std::move(s));
+    }
+
+    StrategyScheduler scheduler(3);
+    scheduler.start();
+
+    TradeRing<64> trades;
+    TradeView view = trades.view();
+    std::vector<BookSnapshot> snaps;
+    for (int i = 0; i < 16; ++i) {
+        snaps.push_back(make_snapshot("SYM" + std::to_string(i), 100.0 + i));
+    }
+
+    for (int tick = 0; tick < 50; ++tick) {
+        scheduler.begin_tick(engine, tick);
+        for (auto& snap : snaps) {
+            scheduler.submit(snap, view);
+        }
+        scheduler.end_tick();
+    }
+    scheduler.stop();
+
+    std::set<std::thread::id> all_threads;
+    for (auto* s : raw) {
+        EXPECT_EQ(s->evaluations.load(), 50 * 16);
+        all_threads.insert(s->threads.begin(), s->threads.end());
+    }
+    // With 8 strategy tasks per tick across 3 workers (plus the helping
+    // tick thread), more than one thread must have run evaluations.
+    EXPECT_GT(all_threads.size(), 1u);
+}
+
+TEST(StrategySchedulerTest, StrategyInstanceNeverRunsConcurrently) {
+    StrategyEngine engine;
+    std::vector<RacyStrategy*> raw;
+    for (int i = 0; i < 4; ++i) {
+        auto s = std::make_unique<RacyStrategy>("racy" + std::to_string(i));
+        raw.push_back(s.get());
+        engine.add_strategy(std::move(s));
+    }
+
+    StrategyScheduler scheduler(3);
+    scheduler.start();
+
+    TradeRing<64> trades;
+    TradeView view = trades.view();
+    std::vector<BookSnapshot> snaps;
+    for (int i = 0; i < 16; ++i) {
+        snaps.push_back(make_snapshot("SYM" + std::to_string(i), 100.0 + i));
+    }
+
+    for (int tick = 0; tick < 50; ++tick) {
+        scheduler.begin_tick(engine, tick);
+        for (auto& snap : snaps) {
+            scheduler.submit(snap, view);
+        }
+        scheduler.end_tick();
+    }
+    scheduler.stop();
+
+    for (auto* s : raw) {
+        EXPECT_EQ(s->overlaps.load(), 0);
+        EXPECT_EQ(s->calls, 50 * 16); // exact despite no synchronization
+    }
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include "common/symbol_table.hpp"
+
+using namespace quantumflow;
+
+static void fill_raw(char (&raw)[SYMBOL_RAW_LEN], const char* sym) {
+    std::memset(raw, 0, sizeof(raw));
+    std::strncpy(raw, sym, sizeof(raw) - 1);
+}
+
+TEST(SymbolTable, InternAssignsDenseIds) {
+    SymbolTable table;
+    EXPECT_EQ(table.intern("BTC-USDT-SWAP"), 0u);
+    EXPECT_EQ(table.intern("ETH-USDT-SWAP"), 1u);
+    EXPECT_EQ(table.intern("SOL-USDT-SWAP"), 2u);
+    EXPECT_EQ(table.size(), 3u);
+}
+
+TEST(SymbolTable, InternIsIdempotent) {
+    SymbolTable table;
+    SymbolId id = table.intern("BTC-USDT-SWAP");
+    EXPECT_EQ(table.intern("BTC-USDT-SWAP"), id);
+    EXPECT_EQ(table.size(), 1u);
+    EXPECT_EQ(table.name(id), "BTC-USDT-SWAP");
+}
+
+TEST(SymbolTable, RawAndStringInternAgree) {
+    SymbolTable table;
+    SymbolId by_name = table.intern("ETH-USDT");
+
+    char raw[SYMBOL_RAW_LEN];
+    fill_raw(raw, "ETH-USDT");
+    EXPECT_EQ(table.intern(raw), by_name);
+    EXPECT_EQ(table.find(raw), by_name);
+}
+
+TEST(SymbolTable, EmptySymbolIsInvalid) {
+    SymbolTable table;
+    char raw[SYMBOL_RAW_LEN]{};
+    EXPECT_EQ(table.intern(raw), INVALID_SYMBOL_ID);
+    EXPECT_EQ(table.find(raw), INVALID_SYMBOL_ID);
+    EXPECT_EQ(table.size(), 0u);
+}
+
+TEST(SymbolTable, SurvivesGrowth) {
+    SymbolTable table;
+    std::vector<SymbolId> ids;
+    for (int i = 0; i < 500; ++i) {
+        char name[SYMBOL_RAW_LEN]{};
+        std::snprintf(name, sizeof(name), "SYM-%03d", i);
+        ids.push_back(table.intern(name));
+    }
+    EXPECT_EQ(table.size(), 500u);
+    for (int i = 0; i < 500; ++i) {
+        char name[SYMBOL_RAW_LEN]{};
+        std::snprintf(name, sizeof(name), "SYM-%03d", i);
+        EXPECT_EQ(table.intern(name), ids[static_cast<size_t>(i)]);
+    }
+}
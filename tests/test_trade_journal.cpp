@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+
+#include "journal/trade_journal.hpp"
+
+using quantumflow::JournalRecord;
+using quantumflow::TradeJournalReader;
+using quantumflow::TradeJournalWriter;
+
+namespace {
+
+std::string temp_path(const char* name) {
+    return std::string("/tmp/qf_journal_test_") + name + "_" +
+           std::to_string(::getpid()) + ".bin";
+}
+
+JournalRecord make_record(uint64_t i) {
+    JournalRecord rec{};
+    rec.sequence = i;
+    rec.timestamp_ns = 1000 + i;
+    rec.price = 50000.0 + static_cast<double>(i);
+    rec.quantity = i * 10;
+    rec.symbol = static_cast<quantumflow::SymbolId>(i % 4);
+    rec.side = static_cast<uint8_t>(i % 2);
+    return rec;
+}
+
+} // namespace
+
+TEST(TradeJournalTest, RoundTripAcrossChunkBoundaries) {
+    const std::string path = temp_path("roundtrip");
+    // More than one 1 MiB chunk so the double-buffered swap is exercised.
+    const uint64_t n = TradeJournalWriter::CHUNK_RECORDS * 2 + 137;
+
+    {
+        TradeJournalWriter writer;
+        ASSERT_TRUE(writer.open(path));
+        for (uint64_t i = 0; i < n; ++i) {
+            // The ring can fill while the writer catches up; retrying is
+            // what a test can do, production counts the drop instead.
+            while (!writer.append(make_record(i))) {
+            }
+        }
+        writer.close();
+        EXPECT_EQ(writer.written_count(), n);
+        EXPECT_EQ(writer.dropped_count(), 0u);
+    }
+
+    TradeJournalReader reader;
+    ASSERT_TRUE(reader.open(path));
+    ASSERT_EQ(reader.size(), n);
+    for (uint64_t i = 0; i < n; i += 997) {
+        const JournalRecord& rec = reader.at(i);
+        EXPECT_EQ(rec.sequence, i);
+        EXPECT_EQ(rec.timestamp_ns, 1000 + i);
+        EXPECT_DOUBLE_EQ(rec.price, 50000.0 + static_cast<double>(i));
+        EXPECT_EQ(rec.quantity, i * 10);
+        EXPECT_EQ(rec.side, static_cast<uint8_t>(i % 2));
+    }
+    EXPECT_EQ(reader.at(n - 1).sequence, n - 1);
+    reader.close();
+    std::remove(path.c_str());
+}
+
+TEST(TradeJournalTest, PartialPageFlushSurvivesClose) {
+    const std::string path = temp_path("partial");
+    const uint64_t n = 13; // far less than one 4 KiB page of records
+
+    {
+        TradeJournalWriter writer;
+        ASSERT_TRUE(writer.open(path));
+        for (uint64_t i = 0; i < n; ++i) {
+            ASSERT_TRUE(writer.append(make_record(i)));
+        }
+        writer.close();
+        EXPECT_EQ(writer.written_count(), n);
+    }
+
+    TradeJournalReader reader;
+    ASSERT_TRUE(reader.open(path));
+    ASSERT_EQ(reader.size(), n);
+    EXPECT_EQ(reader.at(0).sequence, 0u);
+    EXPECT_EQ(reader.at(n - 1).sequence, n - 1);
+    reader.close();
+    std::remove(path.c_str());
+}
+
+TEST(TradeJournalTest, ReaderRejectsGarbage) {
+    const std::string path = temp_path("garbage");
+    {
+        FILE* f = std::fopen(path.c_str(), "wb");
+        ASSERT_NE(f, nullptr);
+        const char junk[8192] = {};
+        std::fwrite(junk, 1, sizeof(junk), f);
+        std::fclose(f);
+    }
+    TradeJournalReader reader;
+    EXPECT_FALSE(reader.open(path));
+    std::remove(path.c_str());
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include "common/trade_ring.hpp"
+
+using namespace quantumflow;
+
+static TradeInfo make_trade(double price, uint64_t qty) {
+    return TradeInfo{price, qty, 0, 0};
+}
+
+TEST(TradeRing, PushAndIterateOldestFirst) {
+    TradeRing<8> ring;
+    EXPECT_TRUE(ring.empty());
+
+    for (int i = 0; i < 5; ++i) {
+        ring.push(make_trade(100.0 + i, 10));
+    }
+    EXPECT_EQ(ring.size(), 5u);
+
+    TradeView view = ring.view();
+    ASSERT_EQ(view.size(), 5u);
+    EXPECT_DOUBLE_EQ(view.front().price, 100.0);
+    EXPECT_DOUBLE_EQ(view.back().price, 104.0);
+
+    double expected = 100.0;
+    for (const auto& t : view) {
+        EXPECT_DOUBLE_EQ(t.price, expected);
+        expected += 1.0;
+    }
+}
+
+TEST(TradeRing, OverwritesOldestWhenFull) {
+    TradeRing<4> ring;
+    for (int i = 0; i < 10; ++i) {
+        ring.push(make_trade(100.0 + i, 10));
+    }
+
+    EXPECT_EQ(ring.size(), 4u);
+    TradeView view = ring.view();
+    EXPECT_DOUBLE_EQ(view[0].price, 106.0);
+    EXPECT_DOUBLE_EQ(view[3].price, 109.0);
+}
+
+TEST(TradeRing, WrappedViewSpansBothSegments) {
+    TradeRing<4> ring;
+    for (int i = 0; i < 6; ++i) {
+        ring.push(make_trade(100.0 + i, 10));
+    }
+
+    // head is mid-array, so the view must stitch two segments together.
+    TradeView view = ring.view();
+    ASSERT_EQ(view.size(), 4u);
+    double expected = 102.0;
+    for (const auto& t : view) {
+        EXPECT_DOUBLE_EQ(t.price, expected);
+        expected += 1.0;
+    }
+}
+
+TEST(TradeRing, ClearResets) {
+    TradeRing<4> ring;
+    ring.push(make_trade(100.0, 10));
+    ring.clear();
+    EXPECT_TRUE(ring.empty());
+    EXPECT_TRUE(ring.view().empty());
+}
+
+TEST(TradeView, ConvertsFromVector) {
+    std::vector<TradeInfo> trades{make_trade(1.0, 1), make_trade(2.0, 2)};
+    TradeView view = trades;
+    ASSERT_EQ(view.size(), 2u);
+    EXPECT_DOUBLE_EQ(view[1].price, 2.0);
+}
@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+
+#include "common/wait_strategy.hpp"
+
+using quantumflow::WaitStrategy;
+
+TEST(WaitStrategyTest, StaysInSpinPhaseForBudget) {
+    WaitStrategy wait(8, 4, 10'000);
+    for (int i = 0; i < 8 + 4; ++i) {
+        EXPECT_TRUE(wait.spinning()) << "iteration " << i;
+        wait.idle();
+    }
+    EXPECT_FALSE(wait.spinning());
+}
+
+TEST(WaitStrategyTest, ResetRewindsToSpinPhase) {
+    WaitStrategy wait(4, 2, 10'000);
+    for (int i = 0; i < 20; ++i) {
+        wait.idle();
+    }
+    EXPECT_FALSE(wait.spinning());
+
+    wait.reset();
+    EXPECT_TRUE(wait.spinning());
+}
+
+TEST(WaitStrategyTest, ZeroBudgetsGoStraightToSleep) {
+    WaitStrategy wait(0, 0, 1'000);
+    EXPECT_FALSE(wait.spinning());
+    // Must not hang or crash: each idle sleeps at most max_sleep_ns.
+    wait.idle();
+    wait.idle();
+}
+
+TEST(WaitStrategyTest, PinCurrentThreadRejectsNegativeCore) {
+    EXPECT_FALSE(quantumflow::pin_current_thread(-1));
+}
@@ -1,6 +1,8 @@
 import { useEffect, useRef, useCallback, useMemo, useState } from 'react';
 import type {
   BookData,
+  BookDeltaPayload,
+  PriceLevel,
   TradeData,
   LatencyData,
   StrategySignalData,
@@ -23,6 +25,29 @@ export interface QuantumFlowState {
 const RECONNECT_DELAY_MS = 2000;
 const MAX_LATENCY_HISTORY = 120;
 
+function requestResync(ws: WebSocket, symbol: string) {
+  if (ws.readyState !== WebSocket.OPEN) return;
+  ws.send(JSON.stringify({ type: 'resync', symbols: [symbol] }));
+}
+
+// Merge changed levels into a sorted side and drop removed prices.
+// Bids are sorted descending, asks ascending.
+function applySideDelta(
+  base: PriceLevel[],
+  changed: PriceLevel[],
+  removed: number[],
+  descending: boolean
+): PriceLevel[] {
+  const byPrice = new Map<number, PriceLevel>();
+  base.forEach(lvl => byPrice.set(lvl.price, lvl));
+  changed.forEach(lvl => byPrice.set(lvl.price, lvl));
+  removed.forEach(price => byPrice.delete(price));
+
+  const next = Array.from(byPrice.values());
+  next.sort((a, b) => (descending ? b.price - a.price : a.price - b.price));
+  return next;
+}
+
 export function useQuantumFlowWs(url: string): QuantumFlowState {
   const [connected, setConnected] = useState(false);
   const [booksBySymbol, setBooksBySymbol] = useState<Record<string, BookData>>({});
@@ -33,6 +58,8 @@ export function useQuantumFlowWs(url: string): QuantumFlowState {
 
   const wsRef = useRef<WebSocket | null>(null);
   const reconnectTimer = useRef<ReturnType<typeof setTimeout>>();
+  const subscribedRef = useRef<Set<string>>(new Set());
+  const bookSeqRef = useRef<Map<string, number>>(new Map());
 
   const setSymbols = useCallback((symbols: string[]) => {
     const ws = wsRef.current;
@@ -55,7 +82,11 @@ export function useQuantumFlowWs(url: string): QuantumFlowState {
     const ws = new WebSocket(url);
     wsRef.current = ws;
 
-    ws.onopen = () => setConnected(true);
+    ws.onopen = () => {
+      subscribedRef.current.clear();
+      bookSeqRef.current.clear();
+      setConnected(true);
+    };
 
     ws.onclose = () => {
       setConnected(false);
@@ -71,9 +102,37 @@ export function useQuantumFlowWs(url: string): QuantumFlowState {
         switch (msg.type) {
           case 'book': {
             const book = msg.data as BookData;
+            bookSeqRef.current.set(book.symbol, book.seq);
             setBooksBySymbol(prev => ({ ...prev, [book.symbol]: book }));
             break;
           }
+          case 'book_delta': {
+            const delta = msg.data as BookDeltaPayload;
+            const lastSeq = bookSeqRef.current.get(delta.symbol);
+            if (lastSeq === undefined || delta.seq !== lastSeq + 1) {
+              // Missed a delta (or never got the snapshot): ask for a full.
+              requestResync(ws, delta.symbol);
+              break;
+            }
+            bookSeqRef.current.set(delta.symbol, delta.seq);
+            setBooksBySymbol(prev => {
+              const base = prev[delta.symbol];
+              if (!base) return prev;
+              return {
+                ...prev,
+                [delta.symbol]: {
+                  symbol: delta.symbol,
+                  seq: delta.seq,
+                  best_bid: delta.best_bid,
+                  best_ask: delta.best_ask,
+                  mid_price: delta.mid_price,
+                  bids: applySideDelta(base.bids, delta.bids, delta.removed_bids, true),
+                  asks: applySideDelta(base.asks, delta.asks, delta.removed_asks, false),
+                },
+              };
+            });
+            break;
+          }
           case 'trades': {
             const payload = msg.data as TradesPayload;
             const symbol = payload.symbol;
@@ -110,6 +169,23 @@ export function useQuantumFlowWs(url: string): QuantumFlowState {
     return Array.from(set).sort();
   }, [booksBySymbol, tradesBySymbol, strategies]);
 
+  // Book and trade frames are published per symbol; opt in as symbols are
+  // discovered (the strategies broadcast carries the full symbol list).
+  useEffect(() => {
+    const ws = wsRef.current;
+    if (!connected || !ws || ws.readyState !== WebSocket.OPEN) return;
+
+    symbols.forEach(sym => {
+      if (subscribedRef.current.has(sym)) return;
+      subscribedRef.current.add(sym);
+      ws.send(`subscribe:book.${sym}`);
+      ws.send(`subscribe:trades.${sym}`);
+      // The delta stream may already be running for other clients; ask for
+      // a full snapshot to seed ours.
+      requestResync(ws, sym);
+    });
+  }, [connected, symbols]);
+
   useEffect(() => {
     connect();
     return () => {
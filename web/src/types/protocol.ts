@@ -6,6 +6,7 @@ export interface PriceLevel {
 
 export interface BookData {
   symbol: string;
+  seq: number;
   best_bid: number;
   best_ask: number;
   mid_price: number;
@@ -13,6 +14,21 @@ export interface BookData {
   asks: PriceLevel[];
 }
 
+// Incremental book update: changed/added levels plus prices that vanished.
+// seq increments per message; a gap means a delta was lost and the client
+// should send { type: 'resync', symbols: [symbol] }.
+export interface BookDeltaPayload {
+  symbol: string;
+  seq: number;
+  best_bid: number;
+  best_ask: number;
+  mid_price: number;
+  bids: PriceLevel[];
+  asks: PriceLevel[];
+  removed_bids: number[];
+  removed_asks: number[];
+}
+
 export interface TradeData {
   symbol: string;
   price: number;
@@ -46,7 +62,7 @@ export interface StrategiesPayload {
   signals: StrategySignalData[];
 }
 
-export type MessageType = 'book' | 'trades' | 'latency' | 'strategies';
+export type MessageType = 'book' | 'book_delta' | 'trades' | 'latency' | 'strategies';
 
 export interface WsMessage<T = unknown> {
   type: MessageType;
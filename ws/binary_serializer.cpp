@@ -0,0 +1,100 @@
+#include "ws/binary_serializer.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace quantumflow {
+
+namespace {
+
+static_assert(std::endian::native == std::endian::little,
+              "binary frames are emitted as raw little-endian fields");
+
+template <typename T>
+inline void append_raw(std::string& out, T value) {
+    char buf[sizeof(T)];
+    std::memcpy(buf, &value, sizeof(T));
+    out.append(buf, sizeof(T));
+}
+
+inline void append_symbol(std::string& out, const std::string& symbol) {
+    char buf[16] = {};
+    std::memcpy(buf, symbol.data(), std::min<size_t>(symbol.size(), sizeof(buf)));
+    out.append(buf, sizeof(buf));
+}
+
+inline void append_level(std::string& out, const PriceLevel& level) {
+    append_raw(out, level.price);
+    append_raw(out, level.quantity);
+    append_raw(out, static_cast<uint32_t>(level.order_count));
+}
+
+} // namespace
+
+void serialize_book_binary(const BookSnapshot& snapshot, std::string& out) {
+    const uint16_t bid_count = static_cast<uint16_t>(
+        std::min<size_t>(snapshot.bids.size(), UINT16_MAX));
+    const uint16_t ask_count = static_cast<uint16_t>(
+        std::min<size_t>(snapshot.asks.size(), UINT16_MAX));
+
+    out.clear();
+    out.reserve(54 + (bid_count + ask_count) * 20u);
+
+    append_raw(out, BINARY_FRAME_MAGIC);
+    append_raw(out, BINARY_FRAME_BOOK);
+    append_symbol(out, snapshot.symbol);
+    append_raw(out, snapshot.timestamp_ns);
+    append_raw(out, snapshot.best_bid);
+    append_raw(out, snapshot.best_ask);
+    append_raw(out, snapshot.mid_price);
+    append_raw(out, bid_count);
+    append_raw(out, ask_count);
+
+    for (uint16_t i = 0; i < bid_count; ++i) {
+        append_level(out, snapshot.bids[i]);
+    }
+    for (uint16_t i = 0; i < ask_count; ++i) {
+        append_level(out, snapshot.asks[i]);
+    }
+}
+
+std::string serialize_book_binary(const BookSnapshot& snapshot) {
+    std::string out;
+    serialize_book_binary(snapshot, out);
+    return out;
+}
+
+void serialize_trades_binary(const std::string& symbol, const TradeView& trades,
+                             uint64_t timestamp_ns, std::string& out) {
+    // Same cap as the JSON path: only the most recent 50 trades.
+    const size_t start = trades.size() > 50 ? trades.size() - 50 : 0;
+    const uint16_t count = static_cast<uint16_t>(trades.size() - start);
+
+    out.clear();
+    out.reserve(28 + count * 25u);
+
+    append_raw(out, BINARY_FRAME_MAGIC);
+    append_raw(out, BINARY_FRAME_TRADES);
+    append_symbol(out, symbol);
+    append_raw(out, timestamp_ns);
+    append_raw(out, count);
+
+    for (size_t i = start; i < trades.size(); ++i) {
+        const TradeInfo& t = trades[i];
+        append_raw(out, t.price);
+        append_raw(out, t.quantity);
+        append_raw(out, t.timestamp_ns);
+        append_raw(out, t.side);
+    }
+}
+
+std::string serialize_trades_binary(const std::string& symbol,
+                                    const TradeView& trades,
+                                    uint64_t timestamp_ns) {
+    std::string out;
+    serialize_trades_binary(symbol, trades, timestamp_ns, out);
+    return out;
+}
+
+} // namespace quantumflow
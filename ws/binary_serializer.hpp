@@ -0,0 +1,47 @@
+#pragma once
+
+#include <string>
+
+#include "strategies/strategy_base.hpp"
+#include "common/trade_ring.hpp"
+
+namespace quantumflow {
+
+/// Compact binary WebSocket frames, negotiated per client ("binary:on").
+/// All fields are fixed-width little-endian, packed without padding.
+///
+/// Book frame (type 1):
+///   uint8  magic = 0x51 ('Q')
+///   uint8  type = 1
+///   char   symbol[16]        (NUL padded)
+///   uint64 timestamp_ns
+///   double best_bid
+///   double best_ask
+///   double mid_price
+///   uint16 bid_count
+///   uint16 ask_count
+///   then bid_count + ask_count levels (bids first, best outward):
+///     double price, uint64 quantity, uint32 order_count
+///
+/// Trades frame (type 2):
+///   uint8  magic = 0x51
+///   uint8  type = 2
+///   char   symbol[16]
+///   uint64 timestamp_ns
+///   uint16 trade_count       (most recent last, capped at 50)
+///   then per trade:
+///     double price, uint64 quantity, uint64 timestamp_ns, uint8 side
+inline constexpr uint8_t BINARY_FRAME_MAGIC = 0x51;
+inline constexpr uint8_t BINARY_FRAME_BOOK = 1;
+inline constexpr uint8_t BINARY_FRAME_TRADES = 2;
+
+void serialize_book_binary(const BookSnapshot& snapshot, std::string& out);
+std::string serialize_book_binary(const BookSnapshot& snapshot);
+
+void serialize_trades_binary(const std::string& symbol, const TradeView& trades,
+                             uint64_t timestamp_ns, std::string& out);
+std::string serialize_trades_binary(const std::string& symbol,
+                                    const TradeView& trades,
+                                    uint64_t timestamp_ns);
+
+} // namespace quantumflow
@@ -84,14 +84,17 @@ inline void append_level(std::string& out, const PriceLevel& lvl) {
 
 } // namespace
 
-std::string serialize_book(const BookSnapshot& snapshot) {
-    std::string out;
+void serialize_book(const BookSnapshot& snapshot, uint64_t seq,
+                    std::string& out) {
+    out.clear();
     out.reserve(256 + snapshot.symbol.size() + (snapshot.bids.size() + snapshot.asks.size()) * 64);
 
     out += "{\"type\":\"book\",\"timestamp_ns\":";
     append_u64(out, snapshot.timestamp_ns);
     out += ",\"data\":{\"symbol\":";
     append_json_string(out, snapshot.symbol);
+    out += ",\"seq\":";
+    append_u64(out, seq);
     out += ",\"best_bid\":";
     append_double(out, snapshot.best_bid);
     out += ",\"best_ask\":";
@@ -111,12 +114,105 @@ std::string serialize_book(const BookSnapshot& snapshot) {
         append_level(out, snapshot.asks[i]);
     }
     out += "]}}";
+}
 
+std::string serialize_book(const BookSnapshot& snapshot, uint64_t seq) {
+    std::string out;
+    serialize_book(snapshot, seq, out);
     return out;
 }
 
-std::string serialize_trades(const std::string& symbol, const std::vector<TradeInfo>& trades, uint64_t timestamp_ns) {
+namespace {
+
+/// Two-pointer walk over one sorted side of two consecutive snapshots.
+/// cmp is the side's sort order: bids descend, asks ascend.
+template <typename Cmp>
+void append_side_delta(std::string& out, const char* name, const char* removed_name,
+                       const std::vector<PriceLevel>& prev,
+                       const std::vector<PriceLevel>& curr, Cmp cmp) {
+    out.push_back('"');
+    out += name;
+    out += "\":[";
+
+    std::string removed;
+    bool first = true;
+    size_t p = 0, c = 0;
+    while (p < prev.size() || c < curr.size()) {
+        const bool only_curr = p == prev.size() ||
+            (c < curr.size() && cmp(curr[c].price, prev[p].price));
+        const bool only_prev = !only_curr &&
+            (c == curr.size() || cmp(prev[p].price, curr[c].price));
+
+        if (only_curr) {
+            // New level.
+            if (!first) out.push_back(',');
+            first = false;
+            append_level(out, curr[c]);
+            ++c;
+        } else if (only_prev) {
+            // Level gone.
+            if (!removed.empty()) removed.push_back(',');
+            append_double(removed, prev[p].price);
+            ++p;
+        } else {
+            // Same price: emit only if quantity or order count changed.
+            if (prev[p].quantity != curr[c].quantity ||
+                prev[p].order_count != curr[c].order_count) {
+                if (!first) out.push_back(',');
+                first = false;
+                append_level(out, curr[c]);
+            }
+            ++p;
+            ++c;
+        }
+    }
+
+    out += "],\"";
+    out += removed_name;
+    out += "\":[";
+    out += removed;
+    out.push_back(']');
+}
+
+} // namespace
+
+void serialize_book_delta(const BookSnapshot& prev, const BookSnapshot& curr,
+                          uint64_t seq, std::string& out) {
+    out.clear();
+    out.reserve(256 + curr.symbol.size());
+
+    out += "{\"type\":\"book_delta\",\"timestamp_ns\":";
+    append_u64(out, curr.timestamp_ns);
+    out += ",\"data\":{\"symbol\":";
+    append_json_string(out, curr.symbol);
+    out += ",\"seq\":";
+    append_u64(out, seq);
+    out += ",\"best_bid\":";
+    append_double(out, curr.best_bid);
+    out += ",\"best_ask\":";
+    append_double(out, curr.best_ask);
+    out += ",\"mid_price\":";
+    append_double(out, curr.mid_price);
+    out.push_back(',');
+    append_side_delta(out, "bids", "removed_bids", prev.bids, curr.bids,
+                      [](double a, double b) { return a > b; });
+    out.push_back(',');
+    append_side_delta(out, "asks", "removed_asks", prev.asks, curr.asks,
+                      [](double a, double b) { return a < b; });
+    out += "}}";
+}
+
+std::string serialize_book_delta(const BookSnapshot& prev,
+                                 const BookSnapshot& curr,
+                                 uint64_t seq) {
     std::string out;
+    serialize_book_delta(prev, curr, seq, out);
+    return out;
+}
+
+void serialize_trades(const std::string& symbol, const TradeView& trades,
+                      uint64_t timestamp_ns, std::string& out) {
+    out.clear();
     out.reserve(256 + symbol.size() * 3 + trades.size() * 96);
 
     const size_t start = trades.size() > 50 ? trades.size() - 50 : 0;
@@ -147,12 +243,60 @@ std::string serialize_trades(const std::string& symbol, const std::vector<TradeI
     }
 
     out += "]}}";
-    return out;
 }
 
-std::string serialize_latency(const LatencySnapshot& latency, uint64_t timestamp_ns) {
+std::string serialize_trades(const std::string& symbol, const TradeView& trades,
+                             uint64_t timestamp_ns) {
     std::string out;
-    out.reserve(256);
+    serialize_trades(symbol, trades, timestamp_ns, out);
+    return out;
+}
+
+namespace {
+
+void append_stage_stats(std::string& out, const char* stage,
+                        const LatencyStageStats& stats) {
+    out.push_back('"');
+    out += stage;
+    out += "\":{\"p50_us\":";
+    append_double(out, stats.p50_us);
+    out += ",\"p99_us\":";
+    append_double(out, stats.p99_us);
+    out += ",\"p999_us\":";
+    append_double(out, stats.p999_us);
+    out += ",\"max_us\":";
+    append_double(out, stats.max_us);
+    out += ",\"count\":";
+    append_u64(out, stats.count);
+    out.push_back('}');
+}
+
+void append_pool_stats(std::string& out, const char* pool,
+                       const SlabPoolStats& stats) {
+    out.push_back('"');
+    out += pool;
+    out += "\":{\"in_use\":";
+    append_u64(out, stats.in_use);
+    out += ",\"capacity\":";
+    append_u64(out, stats.capacity);
+    out += ",\"high_water\":";
+    append_u64(out, stats.high_water);
+    out += ",\"slabs\":";
+    append_u64(out, stats.slab_count);
+    out += ",\"parked_slabs\":";
+    append_u64(out, stats.parked_slabs);
+    out += ",\"reclaimed_slabs\":";
+    append_u64(out, stats.reclaimed_slabs);
+    out.push_back('}');
+}
+
+} // namespace
+
+void serialize_latency(const LatencySnapshot& latency,
+                       const LatencyStats& histogram, uint64_t timestamp_ns,
+                       std::string& out) {
+    out.clear();
+    out.reserve(1024);
 
     out += "{\"type\":\"latency\",\"timestamp_ns\":";
     append_u64(out, timestamp_ns);
@@ -166,16 +310,70 @@ std::string serialize_latency(const LatencySnapshot& latency, uint64_t timestamp
     append_double(out, latency.ws_broadcast_us);
     out += ",\"total_us\":";
     append_double(out, latency.total_us);
-    out += "}}";
+    out += ",\"percentiles\":{";
+    append_stage_stats(out, "python_to_cpp", histogram.python_to_cpp);
+    out.push_back(',');
+    append_stage_stats(out, "send_to_kernel", histogram.send_to_kernel);
+    out.push_back(',');
+    append_stage_stats(out, "kernel_to_drain", histogram.kernel_to_drain);
+    out.push_back(',');
+    append_stage_stats(out, "drain_to_match", histogram.drain_to_match);
+    out.push_back(',');
+    append_stage_stats(out, "order_match", histogram.order_match);
+    out.push_back(',');
+    append_stage_stats(out, "strategy_eval", histogram.strategy_eval);
+    out.push_back(',');
+    append_stage_stats(out, "ws_broadcast", histogram.ws_broadcast);
+    out.push_back(',');
+    append_stage_stats(out, "total", histogram.total);
+    out += "}}}";
+}
+
+void serialize_latency(const LatencySnapshot& latency,
+                       const LatencyStats& histogram,
+                       const BookPoolStats& pools, uint64_t timestamp_ns,
+                       std::string& out) {
+    serialize_latency(latency, histogram, timestamp_ns, out);
+    // Splice the pool telemetry into "data" before its closing braces.
+    out.resize(out.size() - 2);
+    out += ",\"pools\":{";
+    append_pool_stats(out, "orders", pools.orders);
+    out.push_back(',');
+    append_pool_stats(out, "levels", pools.levels);
+    out += "}}}";
+}
 
+std::string serialize_latency(const LatencySnapshot& latency,
+                              const LatencyStats& histogram,
+                              uint64_t timestamp_ns) {
+    std::string out;
+    serialize_latency(latency, histogram, timestamp_ns, out);
     return out;
 }
 
-std::string serialize_strategies(
+namespace {
+
+void append_signal(std::string& out, const StrategySignal& sig) {
+    out += "{\"strategy_name\":";
+    append_json_string(out, sig.strategy_name);
+    out += ",\"symbol\":";
+    append_json_string(out, sig.symbol);
+    out += ",\"signal\":";
+    append_json_string(out, signal_to_string(sig.signal));
+    out += ",\"confidence\":";
+    append_double(out, sig.confidence);
+    out += ",\"timestamp_ns\":";
+    append_u64(out, sig.timestamp_ns);
+    out.push_back('}');
+}
+
+} // namespace
+
+void serialize_strategies(
     const std::unordered_map<std::string, StrategySignal>& signals,
-    uint64_t timestamp_ns)
+    uint64_t timestamp_ns, std::string& out)
 {
-    std::string out;
+    out.clear();
     out.reserve(256 + signals.size() * 128);
 
     out += "{\"type\":\"strategies\",\"timestamp_ns\":";
@@ -187,21 +385,77 @@ std::string serialize_strategies(
         (void)name;
         if (!first) out.push_back(',');
         first = false;
+        append_signal(out, sig);
+    }
+
+    out += "]}}";
+}
+
+void serialize_strategies(const StrategySignal* signals, size_t count,
+                          uint64_t timestamp_ns, std::string& out)
+{
+    out.clear();
+    out.reserve(256 + count * 128);
+
+    out += "{\"type\":\"strategies\",\"timestamp_ns\":";
+    append_u64(out, timestamp_ns);
+    out += ",\"data\":{\"signals\":[";
+
+    for (size_t i = 0; i < count; ++i) {
+        if (i > 0) out.push_back(',');
+        append_signal(out, signals[i]);
+    }
+
+    out += "]}}";
+}
 
-        out += "{\"strategy_name\":";
-        append_json_string(out, sig.strategy_name);
-        out += ",\"symbol\":";
-        append_json_string(out, sig.symbol);
-        out += ",\"signal\":";
-        append_json_string(out, signal_to_string(sig.signal));
+std::string serialize_strategies(
+    const std::unordered_map<std::string, StrategySignal>& signals,
+    uint64_t timestamp_ns)
+{
+    std::string out;
+    serialize_strategies(signals, timestamp_ns, out);
+    return out;
+}
+
+void serialize_strategy_history(const std::string& strategy_name,
+                                const SignalHistoryRing& history,
+                                uint64_t timestamp_ns, std::string& out)
+{
+    out.clear();
+    out.reserve(256 + strategy_name.size() + history.size() * 96);
+
+    out += "{\"type\":\"strategy_history\",\"timestamp_ns\":";
+    append_u64(out, timestamp_ns);
+    out += ",\"data\":{\"strategy\":";
+    append_json_string(out, strategy_name);
+    out += ",\"transitions_total\":";
+    append_u64(out, history.transitions());
+    out += ",\"transitions\":[";
+
+    for (size_t i = 0; i < history.size(); ++i) {
+        const SignalTransition& t = history[i];
+        if (i > 0) out.push_back(',');
+        out += "{\"signal\":";
+        append_json_string(out, signal_to_string(t.signal));
         out += ",\"confidence\":";
-        append_double(out, sig.confidence);
+        append_double(out, t.confidence);
+        out += ",\"confidence_bucket\":";
+        append_u8(out, t.confidence_bucket);
         out += ",\"timestamp_ns\":";
-        append_u64(out, sig.timestamp_ns);
+        append_u64(out, t.timestamp_ns);
         out.push_back('}');
     }
 
     out += "]}}";
+}
+
+std::string serialize_strategy_history(const std::string& strategy_name,
+                                       const SignalHistoryRing& history,
+                                       uint64_t timestamp_ns)
+{
+    std::string out;
+    serialize_strategy_history(strategy_name, history, timestamp_ns, out);
     return out;
 }
 
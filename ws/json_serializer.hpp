@@ -5,27 +5,87 @@
 #include <unordered_map>
 
 #include "strategies/strategy_base.hpp"
+#include "common/latency_histogram.hpp"
 #include "common/latency_snapshot.hpp"
+#include "common/signal_history.hpp"
 #include "common/signal_types.hpp"
 
 namespace quantumflow {
 
-/// Serialize a BookSnapshot to the WebSocket JSON protocol.
-/// { "type": "book", "timestamp_ns": N, "data": {...} }
-std::string serialize_book(const BookSnapshot& snapshot);
+/// Serialize a full BookSnapshot to the WebSocket JSON protocol.
+/// { "type": "book", "timestamp_ns": N, "data": { "seq": N, ... } }
+/// The sequence number ties the snapshot into the delta stream: the next
+/// delta for the symbol carries seq + 1.
+///
+/// Each serializer has two forms: one appending into a caller-provided
+/// buffer (cleared first; used with the PayloadPool so the broadcast tick
+/// reuses capacity instead of allocating) and a returning convenience
+/// wrapper.
+void serialize_book(const BookSnapshot& snapshot, uint64_t seq,
+                    std::string& out);
+std::string serialize_book(const BookSnapshot& snapshot, uint64_t seq);
+
+/// Serialize the difference between two consecutive snapshots of the same
+/// symbol. Changed or added levels are emitted in "bids"/"asks"; prices that
+/// disappeared are listed in "removed_bids"/"removed_asks". Clients that see
+/// a gap in "seq" should request a resync to get a full snapshot.
+/// { "type": "book_delta", "timestamp_ns": N, "data": {...} }
+void serialize_book_delta(const BookSnapshot& prev, const BookSnapshot& curr,
+                          uint64_t seq, std::string& out);
+std::string serialize_book_delta(const BookSnapshot& prev,
+                                 const BookSnapshot& curr,
+                                 uint64_t seq);
 
 /// Serialize recent trades to the WebSocket JSON protocol.
 /// { "type": "trades", "timestamp_ns": N, "data": { "symbol": "...", "trades": [...] } }
-std::string serialize_trades(const std::string& symbol, const std::vector<TradeInfo>& trades, uint64_t timestamp_ns);
+void serialize_trades(const std::string& symbol, const TradeView& trades,
+                      uint64_t timestamp_ns, std::string& out);
+std::string serialize_trades(const std::string& symbol, const TradeView& trades, uint64_t timestamp_ns);
 
 /// Serialize a LatencySnapshot to the WebSocket JSON protocol.
 /// { "type": "latency", "timestamp_ns": N, "data": {...} }
-std::string serialize_latency(const LatencySnapshot& latency, uint64_t timestamp_ns);
+/// Alongside the last-sample fields, each histogram stage is emitted as
+/// "percentiles": { stage: { p50_us, p99_us, p999_us, max_us, count } }.
+void serialize_latency(const LatencySnapshot& latency,
+                       const LatencyStats& histogram, uint64_t timestamp_ns,
+                       std::string& out);
+std::string serialize_latency(const LatencySnapshot& latency,
+                              const LatencyStats& histogram,
+                              uint64_t timestamp_ns);
+
+/// Variant carrying the active book's pool occupancy telemetry: "data"
+/// gains "pools": { "orders": {...}, "levels": {...} } with in-use,
+/// capacity, high-water and slab reclaim counters.
+void serialize_latency(const LatencySnapshot& latency,
+                       const LatencyStats& histogram,
+                       const BookPoolStats& pools, uint64_t timestamp_ns,
+                       std::string& out);
 
 /// Serialize strategy signals to the WebSocket JSON protocol.
 /// { "type": "strategies", "timestamp_ns": N, "data": { "signals": [...] } }
+void serialize_strategies(
+    const std::unordered_map<std::string, StrategySignal>& signals,
+    uint64_t timestamp_ns, std::string& out);
 std::string serialize_strategies(
     const std::unordered_map<std::string, StrategySignal>& signals,
     uint64_t timestamp_ns);
 
+/// Contiguous-array form used with the static strategy engine, whose latest
+/// signals live in a fixed array rather than a map.
+void serialize_strategies(const StrategySignal* signals, size_t count,
+                          uint64_t timestamp_ns, std::string& out);
+
+/// Serialize one strategy's retained signal transitions (on-demand, in
+/// response to a "strategy_history" client request). Transitions are
+/// oldest first; "transitions_total" is the lifetime count so clients can
+/// tell when the ring has overwritten history.
+/// { "type": "strategy_history", "timestamp_ns": N, "data":
+///   { "strategy": "...", "transitions_total": N, "transitions": [...] } }
+void serialize_strategy_history(const std::string& strategy_name,
+                                const SignalHistoryRing& history,
+                                uint64_t timestamp_ns, std::string& out);
+std::string serialize_strategy_history(const std::string& strategy_name,
+                                       const SignalHistoryRing& history,
+                                       uint64_t timestamp_ns);
+
 } // namespace quantumflow
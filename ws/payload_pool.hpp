@@ -0,0 +1,71 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace quantumflow {
+
+/// Immutable refcounted frame payload. A frame is serialized once into a
+/// pooled buffer and the same bytes are shared by every client send; no
+/// further copies are made on the broadcast path.
+using WsPayload = std::shared_ptr<const std::string>;
+
+/// Pool of reusable serialization buffers. acquire() hands out an empty
+/// std::string that keeps the capacity it grew to on earlier frames, so the
+/// steady-state broadcast tick performs no heap allocation for payload
+/// bytes. When the last WsPayload reference drops (all sends and pending
+/// conflation entries done) the buffer returns to the pool.
+class PayloadPool {
+public:
+    /// Process-wide pool. Leaked deliberately so payloads released by the
+    /// WebSocket thread during shutdown never touch a destroyed pool.
+    static PayloadPool& instance() {
+        static PayloadPool* pool = new PayloadPool();
+        return *pool;
+    }
+
+    std::shared_ptr<std::string> acquire() {
+        std::unique_ptr<std::string> buf;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!free_.empty()) {
+                buf = std::move(free_.back());
+                free_.pop_back();
+            }
+        }
+        if (!buf) {
+            buf = std::make_unique<std::string>();
+        }
+        buf->clear();
+        return std::shared_ptr<std::string>(
+            buf.release(), [](std::string* s) { instance().release(s); });
+    }
+
+private:
+    PayloadPool() = default;
+
+    void release(std::string* s) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (free_.size() < MAX_POOLED) {
+            free_.emplace_back(s);
+        } else {
+            delete s;
+        }
+    }
+
+    /// More buffers than frames ever in flight at once (per-tick frames plus
+    /// per-client conflation entries); beyond this, extras are freed.
+    static constexpr size_t MAX_POOLED = 256;
+
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<std::string>> free_;
+};
+
+/// Convenience wrapper used by the broadcast tick.
+inline std::shared_ptr<std::string> acquire_payload() {
+    return PayloadPool::instance().acquire();
+}
+
+} // namespace quantumflow
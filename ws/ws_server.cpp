@@ -9,16 +9,41 @@
 #include <condition_variable>
 #include <cstdio>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "common/wait_strategy.hpp"
 
 namespace quantumflow {
 
 struct WsServer::Impl {
-    struct PerSocketData {};
+    /// A frame waiting for a congested socket to drain. Frames with the same
+    /// key supersede each other, so a slow client only ever holds the newest
+    /// book/trades/latency frame per topic instead of an unbounded backlog.
+    struct PendingFrame {
+        std::string key;
+        WsPayload payload;
+        uWS::OpCode op;
+    };
+
+    struct PerSocketData {
+        bool binary = false;                 // frame encoding negotiated per client
+        std::vector<std::string> topics;     // flavored topics this socket holds
+        std::vector<PendingFrame> pending;   // conflated frames awaiting drain
+        size_t pending_bytes = 0;
+    };
+
+    using WebSocketT = uWS::WebSocket<false, true, PerSocketData>;
+
+    /// Hard ceiling on bytes queued for one client (socket buffer plus
+    /// conflated frames); beyond this the client is disconnected.
+    static constexpr size_t MAX_CLIENT_QUEUE_BYTES = 4 * 1024 * 1024;
 
     std::unique_ptr<uWS::App> app;
     uWS::Loop* loop = nullptr;
     us_listen_socket_t* listen_socket = nullptr;
-    std::vector<uWS::WebSocket<false, true, PerSocketData>*> clients;
+    std::vector<WebSocketT*> clients;
 
     std::thread event_thread;
     std::atomic<bool> running{false};
@@ -30,6 +55,84 @@ struct WsServer::Impl {
     std::condition_variable init_cv;
     bool init_done = false;
     bool init_ok = false;
+
+    // Flavored topic -> subscriber count, updated on the event loop thread,
+    // read from the broadcast thread via has_subscribers().
+    mutable std::mutex topics_mutex;
+    std::unordered_map<std::string, size_t> topic_subscribers;
+
+    static std::string flavored_topic(const std::string& topic, bool binary) {
+        return (binary ? "bin/" : "json/") + topic;
+    }
+
+    void add_subscription(const std::string& full_topic) {
+        std::lock_guard<std::mutex> lock(topics_mutex);
+        ++topic_subscribers[full_topic];
+    }
+
+    void drop_subscription(const std::string& full_topic) {
+        std::lock_guard<std::mutex> lock(topics_mutex);
+        auto it = topic_subscribers.find(full_topic);
+        if (it != topic_subscribers.end() && --it->second == 0) {
+            topic_subscribers.erase(it);
+        }
+    }
+
+    /// Messages all start {"type":"..."}; conflate broadcasts per type so a
+    /// stale latency frame is replaced by the next one, not queued behind it.
+    static std::string conflation_key(const std::string& msg) {
+        static constexpr std::string_view prefix = "{\"type\":\"";
+        if (msg.compare(0, prefix.size(), prefix) == 0) {
+            const size_t end = msg.find('"', prefix.size());
+            if (end != std::string::npos) {
+                return msg.substr(0, end);
+            }
+        }
+        return msg.substr(0, 24);
+    }
+
+    /// Send immediately when the socket is drained, otherwise conflate into
+    /// the per-socket pending list. Returns false when the client exceeded
+    /// MAX_CLIENT_QUEUE_BYTES and should be disconnected.
+    bool send_or_queue(WebSocketT* ws, const std::string& key,
+                       const WsPayload& msg, uWS::OpCode op) {
+        auto* data = ws->getUserData();
+
+        if (ws->getBufferedAmount() == 0 && data->pending.empty()) {
+            ws->send(*msg, op, false);
+            return true;
+        }
+
+        for (auto& frame : data->pending) {
+            if (frame.key == key) {
+                data->pending_bytes -= frame.payload->size();
+                frame.payload = msg;
+                frame.op = op;
+                data->pending_bytes += msg->size();
+                return within_limit(ws, data);
+            }
+        }
+
+        data->pending.push_back({key, msg, op});
+        data->pending_bytes += msg->size();
+        return within_limit(ws, data);
+    }
+
+    static bool within_limit(WebSocketT* ws, PerSocketData* data) {
+        return ws->getBufferedAmount() + data->pending_bytes <=
+               MAX_CLIENT_QUEUE_BYTES;
+    }
+
+    /// Flush pending frames oldest-first while the socket keeps draining.
+    static void flush_pending(WebSocketT* ws) {
+        auto* data = ws->getUserData();
+        while (!data->pending.empty() && ws->getBufferedAmount() == 0) {
+            PendingFrame frame = std::move(data->pending.front());
+            data->pending.erase(data->pending.begin());
+            data->pending_bytes -= frame.payload->size();
+            ws->send(*frame.payload, frame.op, false);
+        }
+    }
 };
 
 WsServer::WsServer() : impl_(std::make_unique<Impl>()) {}
@@ -38,7 +141,7 @@ WsServer::~WsServer() {
     shutdown();
 }
 
-bool WsServer::init(int port) {
+bool WsServer::init(int port, int event_loop_core) {
     if (impl_->running.load(std::memory_order_relaxed) || impl_->event_thread.joinable()) {
         std::fprintf(stderr, "[WsServer] init() called while server thread is active\n");
         return false;
@@ -50,7 +153,9 @@ bool WsServer::init(int port) {
         impl_->init_ok = false;
     }
 
-    impl_->event_thread = std::thread([this, port]() {
+    impl_->event_thread = std::thread([this, port, event_loop_core]() {
+        (void)pin_current_thread(event_loop_core);
+
         impl_->loop = uWS::Loop::get();
 
         impl_->app = std::make_unique<uWS::App>();
@@ -69,8 +174,42 @@ bool WsServer::init(int port) {
                             impl_->clients.size());
             },
 
-            .message = [this](auto* /*ws*/, std::string_view message,
+            .message = [this](auto* ws, std::string_view message,
                               uWS::OpCode /*opCode*/) {
+                auto* data = ws->getUserData();
+
+                // Pub/sub control messages are handled here; anything else
+                // goes to the application message handler.
+                if (message == "binary:on") {
+                    data->binary = true;
+                    return;
+                }
+                if (message == "binary:off") {
+                    data->binary = false;
+                    return;
+                }
+                if (message.rfind("subscribe:", 0) == 0) {
+                    std::string full = Impl::flavored_topic(
+                        std::string(message.substr(10)), data->binary);
+                    auto& t = data->topics;
+                    if (std::find(t.begin(), t.end(), full) == t.end()) {
+                        t.push_back(full);
+                        impl_->add_subscription(full);
+                    }
+                    return;
+                }
+                if (message.rfind("unsubscribe:", 0) == 0) {
+                    std::string full = Impl::flavored_topic(
+                        std::string(message.substr(12)), data->binary);
+                    auto& t = data->topics;
+                    auto it = std::find(t.begin(), t.end(), full);
+                    if (it != t.end()) {
+                        t.erase(it);
+                        impl_->drop_subscription(full);
+                    }
+                    return;
+                }
+
                 MessageHandler handler;
                 {
                     std::lock_guard<std::mutex> lock(impl_->message_handler_mutex);
@@ -81,8 +220,15 @@ bool WsServer::init(int port) {
                 }
             },
 
+            .drain = [](auto* ws) {
+                Impl::flush_pending(ws);
+            },
+
             .close = [this](auto* ws, int /*code*/,
                             std::string_view /*message*/) {
+                for (const auto& full : ws->getUserData()->topics) {
+                    impl_->drop_subscription(full);
+                }
                 auto& c = impl_->clients;
                 c.erase(std::remove(c.begin(), c.end(), ws), c.end());
                 impl_->client_count.store(c.size(),
@@ -124,15 +270,68 @@ void WsServer::poll() {
 }
 
 void WsServer::broadcast(const std::string& message) {
+    broadcast(std::make_shared<const std::string>(message));
+}
+
+void WsServer::broadcast(WsPayload payload) {
     if (!impl_->running.load() || !impl_->loop) return;
 
-    impl_->loop->defer([this, msg = message]() {
+    impl_->loop->defer([this, msg = std::move(payload)]() {
+        const std::string key = Impl::conflation_key(*msg);
+        std::vector<Impl::WebSocketT*> over_limit;
         for (auto* ws : impl_->clients) {
-            ws->send(msg, uWS::OpCode::TEXT, false);
+            if (!impl_->send_or_queue(ws, key, msg, uWS::OpCode::TEXT)) {
+                over_limit.push_back(ws);
+            }
+        }
+        for (auto* ws : over_limit) {
+            std::fprintf(stderr, "[WsServer] Disconnecting slow client "
+                                 "(>%zu bytes queued)\n",
+                         Impl::MAX_CLIENT_QUEUE_BYTES);
+            ws->end(1008, "slow consumer");
         }
     });
 }
 
+void WsServer::publish(const std::string& topic, const std::string& message,
+                       bool binary) {
+    publish(topic, std::make_shared<const std::string>(message), binary);
+}
+
+void WsServer::publish(const std::string& topic, WsPayload payload,
+                       bool binary) {
+    if (!impl_->running.load() || !impl_->loop) return;
+
+    impl_->loop->defer(
+        [this, full = Impl::flavored_topic(topic, binary),
+         msg = std::move(payload), binary]() {
+            const uWS::OpCode op =
+                binary ? uWS::OpCode::BINARY : uWS::OpCode::TEXT;
+            std::vector<Impl::WebSocketT*> over_limit;
+            for (auto* ws : impl_->clients) {
+                const auto& topics = ws->getUserData()->topics;
+                if (std::find(topics.begin(), topics.end(), full) ==
+                    topics.end()) {
+                    continue;
+                }
+                if (!impl_->send_or_queue(ws, full, msg, op)) {
+                    over_limit.push_back(ws);
+                }
+            }
+            for (auto* ws : over_limit) {
+                std::fprintf(stderr, "[WsServer] Disconnecting slow client "
+                                     "(>%zu bytes queued)\n",
+                             Impl::MAX_CLIENT_QUEUE_BYTES);
+                ws->end(1008, "slow consumer");
+            }
+        });
+}
+
+bool WsServer::has_subscribers(const std::string& topic, bool binary) const {
+    std::lock_guard<std::mutex> lock(impl_->topics_mutex);
+    return impl_->topic_subscribers.count(Impl::flavored_topic(topic, binary)) > 0;
+}
+
 void WsServer::set_message_handler(MessageHandler handler) {
     std::lock_guard<std::mutex> lock(impl_->message_handler_mutex);
     impl_->message_handler = std::move(handler);
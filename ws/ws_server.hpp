@@ -6,6 +6,8 @@
 #include <functional>
 #include <memory>
 
+#include "ws/payload_pool.hpp"
+
 namespace quantumflow {
 
 /// WebSocket server wrapping uWebSockets.
@@ -22,13 +24,36 @@ public:
     WsServer& operator=(const WsServer&) = delete;
 
     /// Start listening on the given port. Returns true on success.
-    bool init(int port = 9001);
+    /// event_loop_core >= 0 pins the event-loop thread to that core so the
+    /// broadcast path does not migrate across the consumer's cache domain.
+    bool init(int port = 9001, int event_loop_core = -1);
 
     /// No-op kept for API compatibility (event loop runs in its own thread).
     void poll();
 
-    /// Thread-safe broadcast: defers a text message send to the event loop thread.
+    /// Thread-safe broadcast: defers a text message send to the event loop
+    /// thread. Clients with socket backpressure get frames conflated per
+    /// message type (newest wins) and are disconnected past a hard byte
+    /// limit, so slow links cannot grow the server's memory unboundedly.
     void broadcast(const std::string& message);
+
+    /// Refcounted form: the payload is serialized once and shared by every
+    /// client send; no per-client copies are made.
+    void broadcast(WsPayload payload);
+
+    /// Thread-safe per-topic publish. Clients opt in with "subscribe:<topic>"
+    /// control messages (e.g. "subscribe:book.BTC-USDT-SWAP") and choose the
+    /// frame encoding with "binary:on"/"binary:off" before subscribing; JSON
+    /// and binary subscribers live on separate flavors of the same topic.
+    void publish(const std::string& topic, const std::string& message,
+                 bool binary = false);
+    void publish(const std::string& topic, WsPayload payload,
+                 bool binary = false);
+
+    /// True if any client subscribed to the given flavor of the topic.
+    /// Lets the broadcaster skip serializing frames nobody would receive.
+    bool has_subscribers(const std::string& topic, bool binary = false) const;
+
     void set_message_handler(MessageHandler handler);
 
     /// Graceful shutdown: close all connections, stop listening, join thread.